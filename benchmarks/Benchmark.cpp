@@ -0,0 +1,186 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <ctime>
+#include <thread>
+#include <iomanip>
+#include <algorithm>
+#include <trackers/AllocationCounters.h>
+#include <trackers/MemoryTracker.h>
+#include "Benchmark.h"
+
+using namespace experiments::trackers;
+
+// The allocations are counted by the hook of trackers/AllocationHook.cpp, which is always linked in the benchmark
+// executable.
+
+namespace experiments::benchmarks {
+
+    BenchmarkState::BenchmarkState(int64_t max_iterations)
+        : max_iterations(max_iterations), nb_iterations(0), running(false), total(0),
+          begin_allocations(0), total_allocations(0), begin_bytes(0), total_bytes(0) {}
+
+    bool BenchmarkState::keepRunning() {
+        if (nb_iterations == 0)
+            resumeTiming();
+        if (nb_iterations == max_iterations) {
+            pauseTiming();
+            return false;
+        }
+        ++nb_iterations;
+        return true;
+    }
+
+    void BenchmarkState::pauseTiming() {
+        if (!running)
+            return;
+        total += std::chrono::steady_clock::now() - begin;
+        total_allocations += BenchmarkRegistry::allocations() - begin_allocations;
+        total_bytes += BenchmarkRegistry::bytes() - begin_bytes;
+        running = false;
+    }
+
+    void BenchmarkState::resumeTiming() {
+        if (running)
+            return;
+        running = true;
+        begin_allocations = BenchmarkRegistry::allocations();
+        begin_bytes = BenchmarkRegistry::bytes();
+        begin = std::chrono::steady_clock::now();
+    }
+
+    int64_t BenchmarkState::iterations() const {
+        return nb_iterations;
+    }
+
+    std::chrono::nanoseconds BenchmarkState::elapsed() const {
+        return total;
+    }
+
+    uint64_t BenchmarkState::allocations() const {
+        return total_allocations;
+    }
+
+    uint64_t BenchmarkState::bytes() const {
+        return total_bytes;
+    }
+
+    BenchmarkRegistry &BenchmarkRegistry::instance() {
+        static BenchmarkRegistry registry;
+        return registry;
+    }
+
+    void BenchmarkRegistry::add(const std::string &name, std::function<void(BenchmarkState &)> function) {
+        benchmarks.emplace_back(name, std::move(function));
+    }
+
+    std::vector<BenchmarkResult> BenchmarkRegistry::run(
+        const std::string &filter, double min_time, int repetitions, std::ostream &output
+    ) {
+        std::vector<BenchmarkResult> results;
+        output << std::left << std::setw(50) << "Benchmark" << std::right
+               << std::setw(12) << "Iterations" << std::setw(16) << "ns/op"
+               << std::setw(14) << "allocs/op" << std::setw(14) << "bytes/op"
+               << std::setw(16) << "peak RSS (kB)" << std::endl;
+        for (auto &[name, function] : benchmarks) {
+            if (name.find(filter) == std::string::npos)
+                continue;
+            auto result = run(name, function, min_time, repetitions);
+            output << std::left << std::setw(50) << result.name << std::right;
+            if (result.error.empty()) {
+                output << std::setw(12) << result.iterations << std::setw(16) << std::fixed << std::setprecision(1)
+                       << result.ns_per_op << std::setw(14) << result.allocations_per_op
+                       << std::setw(14) << result.bytes_per_op << std::setw(16) << result.peak_rss_kb << std::endl;
+            } else {
+                output << "  FAILED: " << result.error << std::endl;
+            }
+            results.push_back(result);
+        }
+        return results;
+    }
+
+    BenchmarkResult BenchmarkRegistry::run(
+        const std::string &name, const std::function<void(BenchmarkState &)> &function,
+        double min_time, int repetitions
+    ) {
+        BenchmarkResult result{name, 0, 0, 0, 0, 0, ""};
+        try {
+            // Find the number of iterations needed for the timed part to last at least min_time.
+            int64_t nb_iterations = 1;
+            while (true) {
+                BenchmarkState state(nb_iterations);
+                function(state);
+                double seconds = (double) state.elapsed().count() / 1e9;
+                if (seconds >= min_time || nb_iterations >= 1000000000)
+                    break;
+                double factor = (seconds <= min_time / 100) ? 10 : 1.4 * min_time / seconds;
+                nb_iterations = std::max(nb_iterations + 1, (int64_t) ((double) nb_iterations * factor));
+            }
+
+            // Repeat the benchmark and keep the median.
+            std::vector<BenchmarkResult> repeats;
+            for (int i = 0; i < std::max(1, repetitions); ++i) {
+                BenchmarkState state(nb_iterations);
+                function(state);
+                auto n = (double) state.iterations();
+                repeats.push_back({
+                    name, state.iterations(), (double) state.elapsed().count() / n,
+                    (double) state.allocations() / n, (double) state.bytes() / n, peakRss(), ""
+                });
+            }
+            std::sort(repeats.begin(), repeats.end(), [](auto &a, auto &b) { return a.ns_per_op < b.ns_per_op; });
+            result = repeats[repeats.size() / 2];
+        } catch (const std::exception &e) {
+            result.error = e.what();
+        }
+        return result;
+    }
+
+    void BenchmarkRegistry::writeJson(const std::vector<BenchmarkResult> &results, std::ostream &output) {
+        auto escape = [](const std::string &text) {
+            std::string escaped;
+            for (char c : text) {
+                if (c == '"' || c == '\\')
+                    escaped += '\\';
+                escaped += (c == '\n') ? ' ' : c;
+            }
+            return escaped;
+        };
+
+        output << "{" << std::endl;
+        output << "  \"context\": {\"date\": " << std::time(nullptr)
+               << ", \"nb_cpus\": " << std::thread::hardware_concurrency() << "}," << std::endl;
+        output << "  \"benchmarks\": [" << std::endl;
+        for (int i = 0; i < results.size(); ++i) {
+            auto &result = results[i];
+            output << "    {\"name\": \"" << escape(result.name) << "\"";
+            if (result.error.empty()) {
+                output << std::fixed << std::setprecision(3)
+                       << ", \"iterations\": " << result.iterations
+                       << ", \"ns_per_op\": " << result.ns_per_op
+                       << ", \"allocations_per_op\": " << result.allocations_per_op
+                       << ", \"bytes_per_op\": " << result.bytes_per_op
+                       << ", \"peak_rss_kb\": " << result.peak_rss_kb;
+            } else {
+                output << ", \"error\": \"" << escape(result.error) << "\"";
+            }
+            output << "}" << (i + 1 == results.size() ? "" : ",") << std::endl;
+        }
+        output << "  ]" << std::endl;
+        output << "}" << std::endl;
+    }
+
+    uint64_t BenchmarkRegistry::allocations() {
+        return AllocationCounters::totalAllocations();
+    }
+
+    uint64_t BenchmarkRegistry::bytes() {
+        return AllocationCounters::totalBytes();
+    }
+
+    long BenchmarkRegistry::peakRss() {
+        return MemoryTracker::peakRss();
+    }
+
+}
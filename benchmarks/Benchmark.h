@@ -0,0 +1,161 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_BENCHMARK_H
+#define EXPERIMENTS_AI_TS_BENCHMARK_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstdint>
+#include <functional>
+
+namespace experiments::benchmarks {
+
+    class BenchmarkState {
+    public:
+        /**
+         * Constructor.
+         * @param max_iterations the number of iterations to run
+         */
+        explicit BenchmarkState(int64_t max_iterations);
+
+        /**
+         * Start the next iteration, the timer starts with the first iteration.
+         * @return true if the iteration should be run, false if all the iterations have been run.
+         */
+        bool keepRunning();
+
+        /**
+         * Stop the timer and the allocation counters, e.g., to exclude the setup of an iteration.
+         */
+        void pauseTiming();
+
+        /**
+         * Restart the timer and the allocation counters.
+         */
+        void resumeTiming();
+
+        /**
+         * Getter.
+         * @return the number of iterations run.
+         */
+        [[nodiscard]] int64_t iterations() const;
+
+        /**
+         * Getter.
+         * @return the time spent in the timed part of the iterations.
+         */
+        [[nodiscard]] std::chrono::nanoseconds elapsed() const;
+
+        /**
+         * Getter.
+         * @return the number of allocations done in the timed part of the iterations.
+         */
+        [[nodiscard]] uint64_t allocations() const;
+
+        /**
+         * Getter.
+         * @return the number of bytes allocated in the timed part of the iterations.
+         */
+        [[nodiscard]] uint64_t bytes() const;
+
+    private:
+        int64_t max_iterations;
+        int64_t nb_iterations;
+        bool running;
+        std::chrono::time_point<std::chrono::steady_clock> begin;
+        std::chrono::nanoseconds total;
+        uint64_t begin_allocations;
+        uint64_t total_allocations;
+        uint64_t begin_bytes;
+        uint64_t total_bytes;
+    };
+
+    // Define the result of a benchmark.
+    struct BenchmarkResult {
+        std::string name;
+        int64_t iterations;
+        double ns_per_op;
+        double allocations_per_op;
+        double bytes_per_op;
+        long peak_rss_kb;
+        std::string error;
+    };
+
+    class BenchmarkRegistry {
+    public:
+        /**
+         * Getter.
+         * @return the registry of the process.
+         */
+        static BenchmarkRegistry &instance();
+
+        /**
+         * Register a benchmark.
+         * @param name the name of the benchmark
+         * @param function the function running the iterations of the benchmark
+         */
+        void add(const std::string &name, std::function<void(BenchmarkState &)> function);
+
+        /**
+         * Run the benchmarks whose name contains the filter. The number of iterations of each benchmark is increased
+         * until the timed part lasts at least min_time, then the benchmark is repeated and the median is kept.
+         * @param filter the sub-string that the name of the benchmarks must contain
+         * @param min_time the minimum duration of the timed part of a benchmark in seconds
+         * @param repetitions the number of repetitions of each benchmark
+         * @param output the stream in which the results are displayed as they are produced
+         * @return the results of the benchmarks.
+         */
+        std::vector<BenchmarkResult> run(
+            const std::string &filter, double min_time, int repetitions, std::ostream &output
+        );
+
+        /**
+         * Write the results in JSON format, so that they can be compared between commits.
+         * @param results the results of the benchmarks
+         * @param output the stream in which the results are written
+         */
+        static void writeJson(const std::vector<BenchmarkResult> &results, std::ostream &output);
+
+        /**
+         * Getter.
+         * @return the number of allocations done by the process so far.
+         */
+        static uint64_t allocations();
+
+        /**
+         * Getter.
+         * @return the number of bytes allocated by the process so far.
+         */
+        static uint64_t bytes();
+
+        /**
+         * Getter.
+         * @return the peak resident set size of the process in kilobytes.
+         */
+        static long peakRss();
+
+    private:
+        /**
+         * Run a benchmark.
+         * @param name the name of the benchmark
+         * @param function the function running the iterations of the benchmark
+         * @param min_time the minimum duration of the timed part of the benchmark in seconds
+         * @param repetitions the number of repetitions of the benchmark
+         * @return the result of the benchmark.
+         */
+        static BenchmarkResult run(
+            const std::string &name, const std::function<void(BenchmarkState &)> &function,
+            double min_time, int repetitions
+        );
+
+    private:
+        std::vector<std::pair<std::string, std::function<void(BenchmarkState &)>>> benchmarks;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_BENCHMARK_H
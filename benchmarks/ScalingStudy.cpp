@@ -0,0 +1,149 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <map>
+#include <cmath>
+#include <chrono>
+#include <graphs/FactorGraph.h>
+#include <environments/MazeEnv.h>
+#include <algorithms/planning/MCTSConfig.h>
+#include <algorithms/planning/EvaluationType.h>
+#include <zoo/BTAI.h>
+#include "ScalingStudy.h"
+#include "Benchmark.h"
+
+using namespace hopi::environments;
+using namespace hopi::graphs;
+using namespace hopi::zoo;
+using namespace hopi::algorithms::planning;
+
+namespace experiments::benchmarks {
+
+    std::vector<ScalingPoint> ScalingStudy::run(
+        const std::string &mazes_path,
+        const std::vector<std::string> &mazes,
+        const std::vector<int> &nb_planning_steps,
+        int nb_steps,
+        std::ostream &output
+    ) {
+        // BTAI hyper-parameters, identical to the ones of the main experiment.
+        const double EXPLORATION_CONSTANT = 2;
+        const double PRECISION_PRIOR_PREFERENCES = 3;
+        const double PRECISION_ACTION_SELECTION = 100;
+        const int NB_ACTION_PERCEPTION_CYCLES = 20;
+
+        // The prior preferences of each maze are derived once, and shared by all its planning budgets.
+        std::vector<ScalingPoint> points;
+        for (auto &maze : mazes) {
+            std::shared_ptr<Environment> env = MazeEnv::create(mazes_path + maze);
+            torch::Tensor pref_obs = env->pref_obs();
+            torch::Tensor pref_states = env->pref_states(false);
+            long nb_states = pref_states.numel();
+            for (int planning_steps : nb_planning_steps) {
+                std::shared_ptr<MCTSConfig> config = MCTSConfig::create(
+                    pref_obs,
+                    pref_states,
+                    planning_steps,
+                    EXPLORATION_CONSTANT,
+                    PRECISION_PRIOR_PREFERENCES,
+                    PRECISION_ACTION_SELECTION
+                );
+
+                // Time the action-perception cycles, new episodes are started outside of the timed section.
+                std::chrono::nanoseconds elapsed(0);
+                uint64_t allocations = 0;
+                uint64_t bytes = 0;
+                auto obs = env->reset();
+                auto agent = BTAI::create(env.get(), config, obs);
+                for (int step = 0, cycle = 0; step < nb_steps; ++step, ++cycle) {
+                    if (cycle == NB_ACTION_PERCEPTION_CYCLES || env->solved()) {
+                        FactorGraph::setCurrent(nullptr);
+                        obs = env->reset();
+                        agent = BTAI::create(env.get(), config, obs);
+                        cycle = 0;
+                    }
+                    uint64_t begin_allocations = BenchmarkRegistry::allocations();
+                    uint64_t begin_bytes = BenchmarkRegistry::bytes();
+                    auto begin = std::chrono::steady_clock::now();
+                    agent->step(env, EvaluationType::EFE);
+                    elapsed += std::chrono::steady_clock::now() - begin;
+                    allocations += BenchmarkRegistry::allocations() - begin_allocations;
+                    bytes += BenchmarkRegistry::bytes() - begin_bytes;
+                }
+                FactorGraph::setCurrent(nullptr);
+
+                points.push_back({
+                    maze, nb_states, planning_steps, nb_steps,
+                    (double) elapsed.count() / 1e6 / nb_steps,
+                    (double) allocations / nb_steps,
+                    (double) bytes / nb_steps,
+                    BenchmarkRegistry::peakRss()
+                });
+                output << maze << ", NB_PLANNING_STEPS = " << planning_steps << ": "
+                       << points.back().ms_per_step << " ms/step, "
+                       << points.back().bytes_per_step << " bytes/step" << std::endl;
+            }
+        }
+        return points;
+    }
+
+    std::vector<GrowthFit> ScalingStudy::fit(const std::vector<ScalingPoint> &points) {
+        // Group the points by maze, keeping the order in which the mazes appear.
+        std::vector<std::string> mazes;
+        std::map<std::string, std::vector<std::pair<double, double>>> samples;
+        for (auto &point : points) {
+            if (point.nb_planning_steps <= 0 || point.ms_per_step <= 0)
+                continue;
+            if (samples.find(point.maze) == samples.end())
+                mazes.push_back(point.maze);
+            samples[point.maze].emplace_back(std::log(point.nb_planning_steps), std::log(point.ms_per_step));
+        }
+
+        // Fit log(time) = log(coefficient) + exponent * log(nb_planning_steps) by least squares.
+        std::vector<GrowthFit> fits;
+        for (auto &maze : mazes) {
+            auto &xy = samples[maze];
+            double n = (double) xy.size();
+            double sx = 0, sy = 0, sxx = 0, sxy = 0;
+            for (auto &[x, y] : xy) {
+                sx += x;
+                sy += y;
+                sxx += x * x;
+                sxy += x * y;
+            }
+            double denominator = n * sxx - sx * sx;
+            if (xy.size() < 2 || denominator == 0)
+                continue;
+            double exponent = (n * sxy - sx * sy) / denominator;
+            double intercept = (sy - exponent * sx) / n;
+
+            double ss_res = 0, ss_tot = 0;
+            for (auto &[x, y] : xy) {
+                double residual = y - (intercept + exponent * x);
+                ss_res += residual * residual;
+                ss_tot += (y - sy / n) * (y - sy / n);
+            }
+            double r_squared = (ss_tot == 0) ? 1 : 1 - ss_res / ss_tot;
+            fits.push_back({maze, exponent, std::exp(intercept), r_squared});
+        }
+        return fits;
+    }
+
+    void ScalingStudy::writeCsv(const std::vector<ScalingPoint> &points, std::ostream &output) {
+        output << "maze,nb_states,nb_planning_steps,nb_steps,ms_per_step,allocations_per_step,bytes_per_step,peak_rss_kb" << std::endl;
+        for (auto &point : points) {
+            output << point.maze << "," << point.nb_states << "," << point.nb_planning_steps << ","
+                   << point.nb_steps << "," << point.ms_per_step << "," << point.allocations_per_step << ","
+                   << point.bytes_per_step << "," << point.peak_rss_kb << std::endl;
+        }
+    }
+
+    void ScalingStudy::writeCsv(const std::vector<GrowthFit> &fits, std::ostream &output) {
+        output << "maze,exponent,coefficient_ms,r_squared" << std::endl;
+        for (auto &fit : fits) {
+            output << fit.maze << "," << fit.exponent << "," << fit.coefficient << "," << fit.r_squared << std::endl;
+        }
+    }
+
+}
@@ -0,0 +1,82 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_SCALING_STUDY_H
+#define EXPERIMENTS_AI_TS_SCALING_STUDY_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+namespace experiments::benchmarks {
+
+    // Define the cost of planning measured for one maze and one number of planning steps.
+    struct ScalingPoint {
+        std::string maze;
+        long nb_states;
+        int nb_planning_steps;
+        int nb_steps;
+        double ms_per_step;
+        double allocations_per_step;
+        double bytes_per_step;
+        long peak_rss_kb;
+    };
+
+    // Define the power law time = coefficient * nb_planning_steps^exponent fitted on the points of a maze.
+    struct GrowthFit {
+        std::string maze;
+        double exponent;
+        double coefficient;
+        double r_squared;
+    };
+
+    /**
+     * Scaling study of BTAI planning, i.e., the C++ counterpart of matlab/exponential_explosion.m. The time and memory
+     * per action-perception cycle are measured for increasing numbers of planning steps on several mazes.
+     */
+    class ScalingStudy {
+    public:
+        /**
+         * Measure the cost of planning for each maze and each number of planning steps.
+         * @param mazes_path the directory containing the maze files
+         * @param mazes the names of the maze files
+         * @param nb_planning_steps the numbers of planning steps
+         * @param nb_steps the number of action-perception cycles measured per point
+         * @param output the stream in which the progress is displayed
+         * @return the measured points.
+         */
+        static std::vector<ScalingPoint> run(
+            const std::string &mazes_path,
+            const std::vector<std::string> &mazes,
+            const std::vector<int> &nb_planning_steps,
+            int nb_steps,
+            std::ostream &output
+        );
+
+        /**
+         * Fit a power law on the time per step of each maze, using least squares in log-log space.
+         * An exponent close to one means that planning time grows linearly with the number of planning steps.
+         * @param points the measured points
+         * @return one fit per maze.
+         */
+        static std::vector<GrowthFit> fit(const std::vector<ScalingPoint> &points);
+
+        /**
+         * Write the measured points in CSV format, which can be loaded by matlab/btai_scaling.m.
+         * @param points the measured points
+         * @param output the stream in which the points are written
+         */
+        static void writeCsv(const std::vector<ScalingPoint> &points, std::ostream &output);
+
+        /**
+         * Write the fitted power laws in CSV format, which can be loaded by matlab/btai_scaling.m.
+         * @param fits the fitted power laws
+         * @param output the stream in which the fits are written
+         */
+        static void writeCsv(const std::vector<GrowthFit> &fits, std::ostream &output);
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_SCALING_STUDY_H
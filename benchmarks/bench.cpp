@@ -0,0 +1,234 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <graphs/FactorGraph.h>
+#include <environments/Environment.h>
+#include <environments/EnvType.h>
+#include <algorithms/planning/MCTSConfig.h>
+#include <algorithms/planning/EvaluationType.h>
+#include <zoo/BTAI.h>
+#include <runners/EnvironmentFactory.h>
+#include <runners/CommandLine.h>
+#include <kernels/EFEKernels.h>
+#include <kernels/SmallVector.h>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include "Benchmark.h"
+#include "ScalingStudy.h"
+
+using namespace hopi::environments;
+using namespace hopi::graphs;
+using namespace hopi::zoo;
+using namespace hopi::algorithms::planning;
+using namespace experiments::runners;
+using namespace experiments::benchmarks;
+using namespace experiments::kernels;
+using namespace torch;
+using namespace std;
+
+// BTAI hyper-parameters, identical to the ones of the main experiment.
+const double EXPLORATION_CONSTANT = 2;
+const double PRECISION_PRIOR_PREFERENCES = 3;
+const double PRECISION_ACTION_SELECTION = 100;
+const int NB_ACTION_PERCEPTION_CYCLES = 20;
+
+/**
+ * This function creates the environment whose type is passed as parameter.
+ * @param type the type of environment.
+ * @return the environment.
+ */
+shared_ptr<Environment> createEnv(EnvType type) {
+    ostringstream log;
+    return getEnvAndPerfTracker(type, log).first;
+}
+
+/**
+ * This function creates the MCTS configuration of an environment.
+ * @param env the environment.
+ * @param nb_planning_steps the number of planning iterations per action.
+ * @return the MCTS configuration.
+ */
+shared_ptr<MCTSConfig> createConfig(const shared_ptr<Environment> &env, int nb_planning_steps) {
+    return MCTSConfig::create(
+            env->pref_obs(),
+            env->pref_states(false),
+            nb_planning_steps,
+            EXPLORATION_CONSTANT,
+            PRECISION_PRIOR_PREFERENCES,
+            PRECISION_ACTION_SELECTION
+    );
+}
+
+/**
+ * This function registers the benchmarks of an environment.
+ * @param type the type of environment.
+ */
+void registerBenchmarks(EnvType type) {
+    auto &registry = BenchmarkRegistry::instance();
+    string env_name = getEnvName(type);
+
+    registry.add("env->reset/" + env_name, [type](BenchmarkState &state) {
+        auto env = createEnv(type);
+        while (state.keepRunning()) {
+            env->reset();
+        }
+    });
+
+    registry.add("MCTSConfig::create/" + env_name, [type](BenchmarkState &state) {
+        auto env = createEnv(type);
+        while (state.keepRunning()) {
+            createConfig(env, 100);
+        }
+    });
+
+    registry.add("BTAI::create/" + env_name, [type](BenchmarkState &state) {
+        auto env = createEnv(type);
+        auto config = createConfig(env, 100);
+        while (state.keepRunning()) {
+            state.pauseTiming();
+            auto obs = env->reset();
+            state.resumeTiming();
+            auto agent = BTAI::create(env.get(), config, obs);
+            state.pauseTiming();
+            FactorGraph::setCurrent(nullptr);
+            state.resumeTiming();
+        }
+    });
+
+    for (int nb_planning_steps : {10, 100, 1000}) {
+        string name = "agent->step/" + env_name + "/NB_PLANNING_STEPS=" + to_string(nb_planning_steps);
+        registry.add(name, [type, nb_planning_steps](BenchmarkState &state) {
+            auto env = createEnv(type);
+            auto config = createConfig(env, nb_planning_steps);
+            auto create_agent = [&env, &config]() {
+                FactorGraph::setCurrent(nullptr);
+                auto obs = env->reset();
+                return BTAI::create(env.get(), config, obs);
+            };
+
+            // Start a new episode whenever the current one is over, as in the main experiment.
+            auto agent = create_agent();
+            int cycle = 0;
+            while (state.keepRunning()) {
+                if (cycle == NB_ACTION_PERCEPTION_CYCLES || env->solved()) {
+                    state.pauseTiming();
+                    agent = create_agent();
+                    cycle = 0;
+                    state.resumeTiming();
+                }
+                agent->step(env, EvaluationType::EFE);
+                ++cycle;
+            }
+            FactorGraph::setCurrent(nullptr);
+        });
+    }
+}
+
+/**
+ * This function registers the benchmarks of the EFE kernels, for each backend available on this CPU. The kernels of
+ * a backend are checked against LibTorch first, since timing kernels that compute the wrong values is meaningless.
+ */
+void registerKernelBenchmarks() {
+    auto &registry = BenchmarkRegistry::instance();
+    for (auto backend : {KernelBackend::TORCH, KernelBackend::SCALAR, KernelBackend::AVX2, KernelBackend::AVX512}) {
+        if (!EFEKernels::available(backend))
+            continue;
+        if (backend != KernelBackend::TORCH && EFEKernels::verify(backend) > 1e-4)
+            throw runtime_error("In registerKernelBenchmarks, " + EFEKernels::name(backend) + " is wrong.");
+        for (int n : {16, 64, 256}) {
+            string suffix = "/" + EFEKernels::name(backend) + "/N=" + to_string(n);
+            registry.add("EFEKernels::softmax" + suffix, [backend, n](BenchmarkState &state) {
+                auto &kernels = EFEKernels::table(backend);
+                SmallVector x = SmallVector::fromTensor(rand({n}, dtype(kFloat32)));
+                SmallVector y(n);
+                while (state.keepRunning()) {
+                    kernels.softmax(x.data(), y.data(), n);
+                }
+            });
+            registry.add("EFEKernels::kl" + suffix, [backend, n](BenchmarkState &state) {
+                auto &kernels = EFEKernels::table(backend);
+                SmallVector q = SmallVector::fromTensor(softmax(rand({n}, dtype(kFloat32)), 0));
+                SmallVector p = SmallVector::fromTensor(softmax(rand({n}, dtype(kFloat32)), 0));
+                float kl = 0;
+                while (state.keepRunning()) {
+                    kl += kernels.kl(q.data(), p.data(), n);
+                }
+                if (std::isnan(kl))
+                    throw runtime_error("In EFEKernels::kl benchmark, the divergence is not a number.");
+            });
+        }
+    }
+}
+
+/**
+ * This function runs the scaling study of BTAI planning on the mazes, and writes the results in CSV files.
+ * @param csv_file the file in which the measured points are written, the fits are written in <csv_file>_fit.csv.
+ * @param max_exponent the largest growth exponent accepted, or a negative value to accept any exponent.
+ * @return EXIT_SUCCESS if all the growth exponents are lower than max_exponent, EXIT_FAILURE otherwise.
+ */
+int runScalingStudy(const string &csv_file, double max_exponent) {
+    // Scaling study hyper-parameters.
+    string MAZES_PATH = "../Homing-Pigeon/examples/mazes/";
+    vector<string> MAZES = {"1.maze", "5.maze", "9.maze"};
+    vector<int> NB_PLANNING_STEPS = {10, 20, 50, 100, 200, 500, 1000};
+    int NB_STEPS = 20;
+
+    // Measure the cost of planning, and fit its growth.
+    auto points = ScalingStudy::run(MAZES_PATH, MAZES, NB_PLANNING_STEPS, NB_STEPS, cout);
+    auto fits = ScalingStudy::fit(points);
+
+    // Write the results for matlab/btai_scaling.m.
+    ofstream points_file(csv_file);
+    ScalingStudy::writeCsv(points, points_file);
+    string fit_file = csv_file.substr(0, csv_file.rfind(".csv")) + "_fit.csv";
+    ofstream fits_file(fit_file);
+    ScalingStudy::writeCsv(fits, fits_file);
+
+    // Check that the planning time does not grow faster than allowed.
+    int status = EXIT_SUCCESS;
+    for (auto &fit : fits) {
+        cout << fit.maze << ": time per step ~ " << fit.coefficient << " * NB_PLANNING_STEPS^" << fit.exponent
+             << " ms (R^2 = " << fit.r_squared << ")" << endl;
+        if (max_exponent >= 0 && fit.exponent > max_exponent) {
+            cout << fit.maze << ": growth exponent larger than " << max_exponent << endl;
+            status = EXIT_FAILURE;
+        }
+    }
+    return status;
+}
+
+int main(int argc, char *argv[]) {
+
+    // Parse the command line, i.e., bench [--filter=text] [--min-time=seconds] [--repetitions=n] [--json=file]
+    // or bench --scaling[=file] [--max-exponent=value].
+    CommandLine args(argc, argv, {"filter", "min-time", "repetitions", "json", "scaling", "max-exponent"});
+    if (args.has("scaling")) {
+        manual_seed(0);
+        return runScalingStudy(
+            args.option("scaling", "../results/btai_scaling.csv"), stod(args.option("max-exponent", "-1"))
+        );
+    }
+    string FILTER = args.option("filter", "");
+    double MIN_TIME = stod(args.option("min-time", "0.5"));
+    int REPETITIONS = stoi(args.option("repetitions", "3"));
+    string JSON_FILE = args.option("json", "../results/bench.json");
+
+    // Make the benchmarks reproducible.
+    manual_seed(0);
+
+    // Register and run the benchmarks.
+    for (auto type : {EnvType::MAZE, EnvType::GRAPH, EnvType::FROZEN_LAKE, EnvType::D_SPRITES}) {
+        registerBenchmarks(type);
+    }
+    registerKernelBenchmarks();
+    auto results = BenchmarkRegistry::instance().run(FILTER, MIN_TIME, REPETITIONS, cout);
+
+    // Write the results so that they can be compared between commits.
+    ofstream file(JSON_FILE);
+    BenchmarkRegistry::writeJson(results, file);
+
+    return EXIT_SUCCESS;
+}
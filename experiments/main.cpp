@@ -2,187 +2,49 @@
 // Created by Theophile Champion on 01/07/2021.
 //
 
-#include <graphs/FactorGraph.h>
-#include <environments/GraphEnv.h>
-#include <environments/MazeEnv.h>
+#include <environments/Environment.h>
 #include <environments/EnvType.h>
 #include <algorithms/planning/MCTSConfig.h>
+#include <algorithms/planning/EvaluationType.h>
 #include <trackers/TimeTracker.h>
-#include <trackers/GraphPerformanceTracker.h>
-#include <trackers/MazePerformanceTracker.h>
-#include <zoo/BTAI.h>
-#include <environments/FrozenLakeEnv.h>
+#include <trackers/MemoryTracker.h>
+#include <trackers/ResultSink.h>
+#include <trackers/PhaseTracker.h>
+#include <trackers/StoppingRule.h>
+#include <runners/EpisodeRunner.h>
+#include <runners/EnvironmentFactory.h>
+#include <runners/CommandLine.h>
+#include <runners/Checkpoint.h>
+#include <trackers/TraceRecorder.h>
+#include <trackers/LiveMetrics.h>
+#include <trackers/MetricsServer.h>
 #include <iostream>
-#include <algorithms/planning/EvaluationType.h>
-#include <trackers/FrozenLakePerformanceTracker.h>
-#include <environments/DisentangleSpritesEnv.h>
-#include <trackers/SpritesPerformanceTracker.h>
+#include <sstream>
 
 using namespace hopi::environments;
-using namespace hopi::graphs;
-using namespace hopi::zoo;
 using namespace hopi::algorithms::planning;
 using namespace experiments;
 using namespace experiments::trackers;
+using namespace experiments::runners;
 using namespace torch;
 using namespace std;
 
-// Define a type representing a pair containing an environment and a performance tracker.
-typedef pair<shared_ptr<Environment>, unique_ptr<PerformanceTracker>> EPT_Pair;
-
-/**
- * This function returns the position of the local minimum of the maze whose name is passed as parameters.
- * @param key the name of maze.
- * @return a vector containing the local minimum positions.
- */
-vector<pair<int, int>> getLocalMinima(const std::string &key) {
-    static map<string, vector<pair<int, int>>> map {
-            {"1.maze", {{3,4}}},
-            {"5.maze", {{3,3}}},
-            {"9.maze", {{3,5},{5,3}}}
-    };
-    return map[key];
-}
-
-/**
- * This function returns the environment and performance tracker for the maze environment.
- * @param file in which the loaded environment should be logged.
- * @return a pair containing the environment and the performance tracker.
- */
-EPT_Pair getMazeEnvAndPerfTracker(ofstream &file) {
-    // Maze environment hyper-parameters
-    string MAZES_PATH = "../Homing-Pigeon/examples/mazes/";
-    string MAZE_FILE_NAME = "9.maze";
-    string FULL_MAZE_FILE_NAME = MAZES_PATH + MAZE_FILE_NAME;
-    vector<pair<int,int>> LOCAL_MINIMA = getLocalMinima(MAZE_FILE_NAME);
-
-    // Create the environment and performance tracker.
-    shared_ptr<Environment> env = MazeEnv::create(FULL_MAZE_FILE_NAME);
-    unique_ptr<PerformanceTracker> perf_tracker = MazePerformanceTracker::create(LOCAL_MINIMA);
-
-    // Log the loaded environment.
-    file << "MAZE_FILE_NAME: " << MAZE_FILE_NAME << endl;
-    file << "LOCAL_MINIMA: " << LOCAL_MINIMA << endl;
-
-    return make_pair<>(env, move(perf_tracker));
-}
-
-/**
- * This function returns the environment and performance tracker for the graph environment.
- * @param file in which the loaded environment should be logged.
- * @return a pair containing the environment and the performance tracker.
- */
-EPT_Pair getGraphEnvAndPerfTracker(ofstream &file) {
-    // Hyper-parameters of the graph environment.
-    int NB_GOOD_PATHS = 3;
-    int NB_BAD_PATHS = 5;
-    vector<int> GOOD_PATHS_SIZES = {6,5,8};
-
-    // Create the environment and performance tracker.
-    shared_ptr<Environment> env = GraphEnv::create(NB_GOOD_PATHS, NB_BAD_PATHS, GOOD_PATHS_SIZES);
-    unique_ptr<PerformanceTracker> perf_tracker = GraphPerformanceTracker::create();
-
-    // Log the loaded environment.
-    file << "NB_GOOD_PATHS: " << NB_GOOD_PATHS << endl;
-    file << "NB_BAD_PATHS: " << NB_BAD_PATHS << endl;
-    file << "GOOD_PATHS_SIZES: " << GOOD_PATHS_SIZES << endl;
-
-    return make_pair<>(env, move(perf_tracker));
-}
-
-/**
- * This function returns the environment and performance tracker for the frozen lake environment.
- * @param file in which the loaded environment should be logged.
- * @return a pair containing the environment and the performance tracker.
- */
-EPT_Pair getFrozenLakeEnvAndPerfTracker(ofstream &file) {
-    // Hyper-parameters of the frozen lake environment.
-    string LAKES_PATH = "../Homing-Pigeon/examples/lakes/";
-    string LAKE_FILE_NAME = "5.lake";
-    string FULL_LAKE_FILE_NAME = LAKES_PATH + LAKE_FILE_NAME;
-
-    // Create the environment and performance tracker.
-    shared_ptr<Environment> env = FrozenLakeEnv::create(FULL_LAKE_FILE_NAME);
-    unique_ptr<PerformanceTracker> perf_tracker = FrozenLakePerformanceTracker::create();
-
-    // Log the loaded environment.
-    file << "LAKE_FILE_NAME: " << LAKE_FILE_NAME << endl;
-
-    return make_pair<>(env, move(perf_tracker));
-}
-
-/**
- * This function returns the environment and performance tracker for the dSprites environment.
- * @param file in which the loaded environment should be logged.
- * @return a pair containing the environment and the performance tracker.
- */
-EPT_Pair getSpritesEnvAndPerfTracker(ofstream &file) {
-    // Hyper-parameters of the d-sprites environment.
-    string D_SPRITES_PATH = "../Homing-Pigeon/examples/d_sprites/";
-
-    int GRANULARITY = 4; // Granularity of x and y position, i.e., 1, 2, 4, or 8.
-                         // Granularity of 1 => agent see each position
-                         // Granularity of 2 => agent see each 2x2 square as a single position
-                         // ...
-    int REPEAT = 8; // The number of times an action is repeated before the next perception cycle.
-
-    // Create the environment and performance tracker.
-    shared_ptr<Environment> env = DisentangleSpritesEnv::create(D_SPRITES_PATH, GRANULARITY, REPEAT);
-    unique_ptr<PerformanceTracker> perf_tracker = SpritesPerformanceTracker::create();
-
-    // Log the loaded environment.
-    file << "D_SPRITES_FILE_NAME: " << D_SPRITES_PATH << endl;
-    file << "GRANULARITY: " << GRANULARITY << endl;
-    file << "REPEAT: " << REPEAT << endl;
-
-    return make_pair<>(env, move(perf_tracker));
-}
-
-/**
- * This function returns the environment in which the agent should be run, and the associated tracker of
- * performance.
- * @param type the type of environment.
- * @param file in which the loaded environment should be described.
- * @return a pair containing the environment and the performance tracker.
- */
-EPT_Pair getEnvAndPerfTracker(EnvType type, ofstream &file) {
-    static map<EnvType, EPT_Pair (*)(ofstream &file)> map {
-            {EnvType::MAZE,        &getMazeEnvAndPerfTracker},
-            {EnvType::GRAPH,       &getGraphEnvAndPerfTracker},
-            {EnvType::FROZEN_LAKE, &getFrozenLakeEnvAndPerfTracker},
-            {EnvType::D_SPRITES,   &getSpritesEnvAndPerfTracker}
-    };
-
-    file << "========== ENVIRONMENT CONFIGURATION ==========" << std::endl;
-    auto [env, perf_tracker] = (*map[type])(file);
-    file << endl;
-    return make_pair<>(env, move(perf_tracker));
-}
-
-/**
- * This function transform the environment name (string) into the environment type (EnvType).
- * @param name the environment name.
- * @return the environment type.
- */
-EnvType getEnvType(char *name) {
-    static map<string, EnvType> map {
-            {"maze",    EnvType::MAZE},
-            {"graph",   EnvType::GRAPH},
-            {"lake",    EnvType::FROZEN_LAKE},
-            {"sprites", EnvType::D_SPRITES}
-    };
-
-    return map[string(name)];
-}
-
 int main(int argc, char *argv[]) {
 
+    // Parse the command line, i.e., main [env] [--seed=S] [--replay=episode] [--results=directory] [--trace=file]
+    // [--metrics=port|socket] [--checkpoint=file] [--checkpoint-interval=seconds] [--resume] [--stop-width=w]
+    // [--stop-baseline=p] [--stop-effect=d] [--stop-min-episodes=n] [--stop-confidence=c] [--max-simulations=n].
+    CommandLine args(argc, argv, {
+        "seed", "replay", "results", "trace", "metrics", "checkpoint", "checkpoint-interval", "resume", "stop-width",
+        "stop-baseline", "stop-effect", "stop-min-episodes", "stop-confidence", "max-simulations"
+    });
+
     // Open the file in which the result should be written.
     ofstream file;
     file.open("../results/BTAI_BF_section_3.txt", std::ios_base::app);
 
     // Get environment type.
-    EnvType envType = (argc <= 1) ? EnvType::GRAPH : getEnvType(argv[1]);
+    EnvType envType = getEnvType(args.positional(0, "graph"));
 
     // Get environment and performance tracker.
     auto [env, perf_tracker] = getEnvAndPerfTracker(envType, file);
@@ -194,6 +56,21 @@ int main(int argc, char *argv[]) {
     // Demo hyper-parameters.
     int NB_SIMULATIONS = 100;
     int NB_ACTION_PERCEPTION_CYCLES = 20;
+    uint64_t SEED = stoull(args.option("seed", "0")); // Each episode draws from streams keyed by SEED and its index.
+    StoppingOptions STOPPING; // Stop once the outcome probabilities are precise enough, or decided against a baseline.
+    STOPPING.target_width = stod(args.option("stop-width", "0"));
+    STOPPING.baseline = stod(args.option("stop-baseline", "-1"));
+    STOPPING.effect = stod(args.option("stop-effect", "0.1"));
+    STOPPING.min_episodes = stoi(args.option("stop-min-episodes", "20"));
+    STOPPING.confidence = stod(args.option("stop-confidence", "0.95"));
+    bool ADAPTIVE = STOPPING.target_width > 0 || STOPPING.baseline > 0;
+    if (ADAPTIVE) // NB_SIMULATIONS becomes the maximum number of episodes.
+        NB_SIMULATIONS = stoi(args.option("max-simulations", "1000"));
+    int FIRST_EPISODE = 0;
+    if (args.has("replay")) { // Replay a single episode, e.g., to profile it.
+        FIRST_EPISODE = stoi(args.option("replay", "0"));
+        NB_SIMULATIONS = 1;
+    }
 
     // BTAI hyper-parameters
     int    NB_PLANNING_STEPS = 100;
@@ -203,7 +80,7 @@ int main(int argc, char *argv[]) {
     EvaluationType EVALUATION_TYPE = EvaluationType::EFE;
 
     // Create MCTS configuration.
-    auto tConfig = MCTSConfig::create(
+    shared_ptr<MCTSConfig> tConfig = MCTSConfig::create(
             OBS_PREF,
             STATES_PREF,
             NB_PLANNING_STEPS,
@@ -212,13 +89,18 @@ int main(int argc, char *argv[]) {
             PRECISION_ACTION_SELECTION
     );
 
-    // Create time tracker.
-    auto time_tracker = TimeTracker::create(NB_SIMULATIONS);
+    // Create time and memory trackers.
+    auto time_tracker = TimeTracker::create();
+    auto memory_tracker = MemoryTracker::create();
 
     // Log the experiment configuration.
     file << "========== EXPERIMENT CONFIGURATION ==========" << std::endl;
     file << "NB_SIMULATIONS: " << NB_SIMULATIONS << std::endl;
     file << "NB_ACTION_PERCEPTION_CYCLES: " << NB_ACTION_PERCEPTION_CYCLES << std::endl;
+    file << "SEED: " << SEED << std::endl;
+    file << "FIRST_EPISODE: " << FIRST_EPISODE << std::endl;
+    file << "STOP_WIDTH: " << STOPPING.target_width << std::endl;
+    file << "STOP_BASELINE: " << STOPPING.baseline << " +/- " << STOPPING.effect << std::endl;
     file << "NB_PLANNING_STEPS: " << NB_PLANNING_STEPS << std::endl;
     file << "EXPLORATION_CONSTANT: " << EXPLORATION_CONSTANT << std::endl;
     file << "PRECISION_PRIOR_PREFERENCES: " << PRECISION_PRIOR_PREFERENCES << std::endl;
@@ -228,34 +110,73 @@ int main(int argc, char *argv[]) {
     // Initialise trackers.
     perf_tracker->reset();
 
-    // Run the episodes.
-    for (int j = 0; j < NB_SIMULATIONS; ++j) {
-
-        // Reset environment and create agent.
-        auto obs = env->reset();
-        auto agent = BTAI::create(env.get(), tConfig, obs);
-
-        // Run one episode.
-        // env->print(); //TODO
-        time_tracker->tic();
-        for (int k = 0; k < NB_ACTION_PERCEPTION_CYCLES; ++k) {
-            agent->step(env, EVALUATION_TYPE);
-            // env->print(); //TODO
-            if (env->solved())
-                break;
-        }
-        time_tracker->toc();
+    // Create the sink in which one row per episode is written, along with the experiment configuration.
+    ResultSink::Configuration CONFIGURATION = {
+            {"env", getEnvName(envType)},
+            {"nb_planning_steps", to_string(NB_PLANNING_STEPS)},
+            {"exploration_constant", to_string(EXPLORATION_CONSTANT)},
+            {"precision_prior_preferences", to_string(PRECISION_PRIOR_PREFERENCES)},
+            {"precision_action_selection", to_string(PRECISION_ACTION_SELECTION)},
+            {"stop_width", to_string(STOPPING.target_width)},
+            {"stop_baseline", to_string(STOPPING.baseline)}
+    };
+    auto result_sink = ResultSink::create(args.option("results", "../results/episodes"), CONFIGURATION);
+
+    // Create the checkpoint of the run, and continue from the last checkpoint of an interrupted run, if requested.
+    unique_ptr<Checkpoint> checkpoint;
+    if (args.has("checkpoint") || args.has("resume")) {
+        checkpoint = Checkpoint::create(
+                args.option("checkpoint", "../results/BTAI_checkpoint.txt"),
+                getPerfTracker(envType, EnvironmentOptions()),
+                CONFIGURATION,
+                SEED,
+                FIRST_EPISODE,
+                NB_SIMULATIONS,
+                chrono::seconds(stoi(args.option("checkpoint-interval", "10")))
+        );
+        if (args.has("resume") && checkpoint->load())
+            file << "RESUMED_EPISODES: " << checkpoint->nbCompleted() << std::endl << std::endl;
+    }
 
-        // Clean up memory.
-        FactorGraph::setCurrent(nullptr);
+    // Start recording the trace of the run, if requested.
+    if (args.has("trace"))
+        TraceRecorder::instance().start(args.option("trace", "../results/BTAI_trace.json"));
 
-        // Evaluate simulation.
-        perf_tracker->track(env);
+    // Publish the running metrics of the experiment on a local port or a Unix socket, if requested.
+    unique_ptr<MetricsServer> metrics_server;
+    if (args.has("metrics")) {
+        LiveMetrics::instance().start(*perf_tracker, checkpoint ? checkpoint->nbCompleted() : 0);
+        metrics_server = MetricsServer::create(args.option("metrics", "9464"), LiveMetrics::instance());
     }
 
+    // Run the episodes, the runner creates its own environment and performance tracker.
+    auto runner = EpisodeRunner::create(
+            [envType]() {
+                ostringstream log;
+                return getEnvAndPerfTracker(envType, log);
+            },
+            tConfig,
+            NB_SIMULATIONS,
+            NB_ACTION_PERCEPTION_CYCLES,
+            EVALUATION_TYPE,
+            SEED,
+            FIRST_EPISODE
+    );
+    auto stopping_rule = ADAPTIVE ? StoppingRule::create(STOPPING) : nullptr;
+    runner->run(
+            *perf_tracker, *time_tracker, *memory_tracker, result_sink.get(), checkpoint.get(), stopping_rule.get()
+    );
+    TraceRecorder::instance().stop();
+    LiveMetrics::instance().stop();
+    metrics_server.reset();
+
     // Print trackers results
     perf_tracker->print(file);
     time_tracker->print(file);
+    memory_tracker->print(file);
+    PhaseTracker::instance().print(file);
+    if (stopping_rule)
+        stopping_rule->print(file, perf_tracker->snapshot(), perf_tracker->successOutcome());
 
     return EXIT_SUCCESS;
 }
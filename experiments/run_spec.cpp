@@ -0,0 +1,136 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <environments/Environment.h>
+#include <environments/EnvType.h>
+#include <algorithms/planning/MCTSConfig.h>
+#include <algorithms/planning/EvaluationType.h>
+#include <trackers/TimeTracker.h>
+#include <trackers/MemoryTracker.h>
+#include <trackers/ResultSink.h>
+#include <trackers/PhaseTracker.h>
+#include <trackers/StoppingRule.h>
+#include <runners/EpisodeRunner.h>
+#include <runners/EnvironmentFactory.h>
+#include <runners/ExperimentSpec.h>
+#include <runners/CommandLine.h>
+#include <environments/EnvironmentPool.h>
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+using namespace hopi::environments;
+using namespace hopi::algorithms::planning;
+using namespace experiments::trackers;
+using namespace experiments::runners;
+using namespace experiments::environments;
+using namespace torch;
+using namespace std;
+
+/**
+ * This function runs the experiment associated with a point of the specification.
+ * @param point the point of the specification.
+ * @param pool the pool of environments shared by all the points.
+ * @param results the directory in which one row per episode should be written.
+ * @param output the stream in which the results should be written.
+ */
+void runPoint(const ExperimentPoint &point, EnvironmentPool &pool, const string &results, ostream &output) {
+    // Take the environments from the pool, the runner only uses the environment of the factory's pairs.
+    string key = point.environmentKey();
+    auto loader = [&point]() {
+        ostringstream log;
+        return getEnvAndPerfTracker(point.env_type, point.env_options, log).first;
+    };
+    auto factory = [&pool, &key, &loader]() {
+        return EPT_Pair(pool.acquire(key, loader), nullptr);
+    };
+    auto perf_tracker = getPerfTracker(point.env_type, point.env_options);
+
+    // Create MCTS configuration.
+    shared_ptr<MCTSConfig> tConfig;
+    {
+        auto env = pool.acquire(key, loader);
+        tConfig = MCTSConfig::create(
+                env->pref_obs(),
+                env->pref_states(false),
+                point.nb_planning_steps,
+                point.exploration_constant,
+                point.precision_prior_preferences,
+                point.precision_action_selection
+        );
+    }
+
+    // Log the experiment configuration.
+    EvaluationType EVALUATION_TYPE = EvaluationType::EFE;
+    output << "========== EXPERIMENT CONFIGURATION ==========" << std::endl;
+    output << "POINT: " << point.index << std::endl;
+    for (auto &[name, value] : point.parameters) {
+        string upper_name = name;
+        transform(upper_name.begin(), upper_name.end(), upper_name.begin(), ::toupper);
+        output << upper_name << ": " << value << std::endl;
+    }
+    output << "EVALUATION_TYPE: " << EVALUATION_TYPE << std::endl << std::endl;
+
+    // Run the episodes.
+    auto time_tracker = TimeTracker::create();
+    auto memory_tracker = MemoryTracker::create();
+    PhaseTracker::instance().reset();
+    auto result_sink = ResultSink::create(results, point.parameters);
+    auto runner = EpisodeRunner::create(
+            factory,
+            tConfig,
+            point.nb_simulations,
+            point.nb_action_perception_cycles,
+            EVALUATION_TYPE,
+            point.seed
+    );
+    auto stopping_rule = point.adaptive() ? StoppingRule::create(point.stopping) : nullptr;
+    runner->run(
+            *perf_tracker, *time_tracker, *memory_tracker, result_sink.get(), nullptr, stopping_rule.get()
+    );
+
+    // Print trackers results
+    perf_tracker->print(output);
+    time_tracker->print(output);
+    memory_tracker->print(output);
+    PhaseTracker::instance().print(output);
+    if (stopping_rule)
+        stopping_rule->print(output, perf_tracker->snapshot(), perf_tracker->successOutcome());
+}
+
+int main(int argc, char *argv[]) {
+
+    // Parse the command line, i.e., run_spec spec.json [--dry-run].
+    CommandLine args(argc, argv, {"dry-run"});
+    auto spec = ExperimentSpec::load(args.positional(0, "../experiments/specs/sweep.json"));
+    auto &points = spec->points();
+
+    // List the points without running them, e.g., to check the expansion of a specification.
+    if (args.has("dry-run")) {
+        for (auto &point : points) {
+            cout << point.index << ":";
+            for (auto &[name, value] : point.parameters) {
+                cout << " " << name << "=" << value;
+            }
+            cout << endl;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    // Open the file in which the results should be written.
+    ofstream file;
+    file.open(spec->output(), std::ios_base::app);
+
+    // Run all the points in this process, the loaded environments and the LibTorch runtime are reused by the
+    // successive points.
+    auto pool = EnvironmentPool::create();
+    for (auto &point : points) {
+        cout << "Running point " << point.index + 1 << "/" << points.size() << "..." << endl;
+        runPoint(point, *pool, spec->results(), file);
+        file.flush();
+    }
+    cout << "Environments loaded: " << pool->misses() << ", reused: " << pool->hits() << "." << endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <environments/Environment.h>
+#include <environments/EnvType.h>
+#include <algorithms/planning/MCTSConfig.h>
+#include <algorithms/planning/EvaluationType.h>
+#include <trackers/TimeTracker.h>
+#include <trackers/MemoryTracker.h>
+#include <trackers/PhaseTracker.h>
+#include <runners/EpisodeRunner.h>
+#include <runners/EnvironmentFactory.h>
+#include <runners/SweepLauncher.h>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+using namespace hopi::environments;
+using namespace hopi::algorithms::planning;
+using namespace experiments::trackers;
+using namespace experiments::runners;
+using namespace torch;
+using namespace std;
+
+/**
+ * This function runs the experiment associated with a point of the sweep.
+ * @param point the sweep point.
+ * @param output the stream in which the results should be written.
+ * @return the performance tracker of the point, which is merged with the points of the same configuration.
+ */
+unique_ptr<PerformanceTracker> runSweepPoint(const SweepPoint &point, ostream &output) {
+    // Get environment and performance tracker.
+    output << "========== ENVIRONMENT CONFIGURATION ==========" << std::endl;
+    auto [env, perf_tracker] = getEnvAndPerfTracker(point.env_type, output);
+    output << endl;
+
+    // Demo hyper-parameters.
+    int NB_SIMULATIONS = 100;
+    int NB_ACTION_PERCEPTION_CYCLES = 20;
+
+    // BTAI hyper-parameters
+    double PRECISION_PRIOR_PREFERENCES = 3;
+    double PRECISION_ACTION_SELECTION = 100;
+    EvaluationType EVALUATION_TYPE = EvaluationType::EFE;
+
+    // Create MCTS configuration.
+    shared_ptr<MCTSConfig> tConfig = MCTSConfig::create(
+            env->pref_obs(),
+            env->pref_states(false),
+            point.nb_planning_steps,
+            point.exploration_constant,
+            PRECISION_PRIOR_PREFERENCES,
+            PRECISION_ACTION_SELECTION
+    );
+
+    // Log the experiment configuration.
+    output << "========== EXPERIMENT CONFIGURATION ==========" << std::endl;
+    output << "NB_SIMULATIONS: " << NB_SIMULATIONS << std::endl;
+    output << "NB_ACTION_PERCEPTION_CYCLES: " << NB_ACTION_PERCEPTION_CYCLES << std::endl;
+    output << "PRECISION_PRIOR_PREFERENCES: " << PRECISION_PRIOR_PREFERENCES << std::endl;
+    output << "PRECISION_ACTION_SELECTION: " << PRECISION_ACTION_SELECTION << std::endl;
+    output << "EVALUATION_TYPE: " << EVALUATION_TYPE << std::endl << std::endl;
+
+    // Run the episodes, the parallelism comes from the worker processes.
+    auto time_tracker = TimeTracker::create();
+    auto memory_tracker = MemoryTracker::create();
+    perf_tracker->reset();
+    PhaseTracker::instance().reset();
+    auto runner = EpisodeRunner::create(
+            [&point]() {
+                ostringstream log;
+                return getEnvAndPerfTracker(point.env_type, log);
+            },
+            tConfig,
+            NB_SIMULATIONS,
+            NB_ACTION_PERCEPTION_CYCLES,
+            EVALUATION_TYPE,
+            point.seed
+    );
+    runner->run(*perf_tracker, *time_tracker, *memory_tracker);
+
+    // Print trackers results
+    perf_tracker->print(output);
+    time_tracker->print(output);
+    memory_tracker->print(output);
+    PhaseTracker::instance().print(output);
+    return std::move(perf_tracker);
+}
+
+int main(int argc, char *argv[]) {
+
+    // Get the number of worker processes.
+    int NB_PROCESSES = (argc <= 1) ? (int) std::thread::hardware_concurrency() : stoi(argv[1]);
+
+    // Sweep hyper-parameters.
+    vector<EnvType> ENV_TYPES = {EnvType::MAZE, EnvType::FROZEN_LAKE};
+    vector<int> NB_PLANNING_STEPS = {10, 50, 100};
+    vector<double> EXPLORATION_CONSTANTS = {1, 2, 4};
+    vector<unsigned long> SEEDS = {0, 1, 2};
+
+    // Open the file in which the merged report should be written.
+    ofstream file;
+    file.open("../results/BTAI_BF_sweep.txt", std::ios_base::app);
+
+    // Run the sweep.
+    auto launcher = SweepLauncher::create(
+            SweepLauncher::grid(ENV_TYPES, NB_PLANNING_STEPS, EXPLORATION_CONSTANTS, SEEDS),
+            std::max(1, NB_PROCESSES),
+            "../results/sweep_shards"
+    );
+    int nb_failures = launcher->run(&runSweepPoint, file);
+
+    return (nb_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
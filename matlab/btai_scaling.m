@@ -0,0 +1,54 @@
+% Plot the scaling study of BTAI planning produced by: bench --scaling
+%__________________________________________________________________________
+%
+% The C++ benchmark measures the time and memory per action-perception
+% cycle for increasing numbers of planning steps on several mazes, and fits
+% the power law: time = coefficient * NB_PLANNING_STEPS^exponent. The
+% results are compared to the time taken by SPM's planner on the maze of
+% exponential_explosion.m, which grows exponentially with the number of
+% moves considered by the policies.
+%__________________________________________________________________________
+
+points = readtable('../results/btai_scaling.csv', 'TextType', 'string');
+fits   = readtable('../results/btai_scaling_fit.csv', 'TextType', 'string');
+
+% time reported in exponential_explosion.m, 7 moves crashed
+%--------------------------------------------------------------------------
+spm_moves = [2 3 4 5 6];
+spm_time  = [0.865816 5.069928 44.500457 298.468461 2642.404988];
+
+mazes = unique(points.maze, 'stable');
+figure
+
+% BTAI: time per step as a function of the number of planning steps
+%--------------------------------------------------------------------------
+subplot(1,3,1), hold on
+for i = 1:numel(mazes)
+    p = points(points.maze == mazes(i), :);
+    f = fits(fits.maze == mazes(i), :);
+    loglog(p.nb_planning_steps, p.ms_per_step, 'o')
+    loglog(p.nb_planning_steps, f.coefficient_ms * p.nb_planning_steps .^ f.exponent, '-')
+end
+set(gca, 'XScale', 'log', 'YScale', 'log')
+xlabel('NB\_PLANNING\_STEPS'), ylabel('time per step (ms)'), axis square
+legend(reshape([mazes, mazes + " (fit)"]', [], 1), 'Location', 'northwest')
+title('BTAI')
+
+% BTAI: memory allocated per step
+%--------------------------------------------------------------------------
+subplot(1,3,2), hold on
+for i = 1:numel(mazes)
+    p = points(points.maze == mazes(i), :);
+    loglog(p.nb_planning_steps, p.bytes_per_step / 1024, 'o-')
+end
+set(gca, 'XScale', 'log', 'YScale', 'log')
+xlabel('NB\_PLANNING\_STEPS'), ylabel('memory allocated per step (kB)'), axis square
+legend(mazes, 'Location', 'northwest')
+title('BTAI')
+
+% SPM: time as a function of the number of moves
+%--------------------------------------------------------------------------
+subplot(1,3,3)
+semilogy(spm_moves, spm_time, 'o-')
+xlabel('number of moves'), ylabel('time (s)'), axis square
+title('SPM (exponential\_explosion.m)')
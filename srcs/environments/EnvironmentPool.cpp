@@ -0,0 +1,41 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include "EnvironmentPool.h"
+
+using namespace hopi::environments;
+
+namespace experiments::environments {
+
+    std::unique_ptr<EnvironmentPool> EnvironmentPool::create() {
+        return std::make_unique<EnvironmentPool>();
+    }
+
+    std::shared_ptr<Environment> EnvironmentPool::acquire(const std::string &key, const EnvLoader &loader) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &pool = envs[key];
+        for (auto &env : pool) {
+            if (env.use_count() == 1) {
+                ++nb_hits;
+                return env;
+            }
+        }
+
+        // The environment is loaded under the lock, so that several workers do not load the same file at once.
+        ++nb_misses;
+        pool.push_back(loader());
+        return pool.back();
+    }
+
+    uint64_t EnvironmentPool::hits() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return nb_hits;
+    }
+
+    uint64_t EnvironmentPool::misses() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return nb_misses;
+    }
+
+}
@@ -0,0 +1,71 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_ENVIRONMENT_POOL_H
+#define EXPERIMENTS_AI_TS_ENVIRONMENT_POOL_H
+
+#include <map>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+namespace hopi::environments {
+    class Environment;
+}
+
+namespace experiments::environments {
+
+    /**
+     * Pool of loaded environments, shared by the successive configurations of an experiment run by a single
+     * process. An environment is free when the pool holds the only reference to it, and is then handed to the next
+     * configuration asking for an environment with the same key, instead of being loaded again. The runners reset
+     * an environment before each episode, so its previous episodes do not leak into the next configuration.
+     */
+    class EnvironmentPool {
+    public:
+        // Define a type representing a function loading a new environment.
+        typedef std::function<std::shared_ptr<hopi::environments::Environment>()> EnvLoader;
+
+    public:
+        /**
+         * Create an environment pool.
+         * @return the environment pool.
+         */
+        static std::unique_ptr<EnvironmentPool> create();
+
+        /**
+         * Acquire a free environment, loading a new one if all the environments with this key are in use. The
+         * environment is released when the last copy of the returned pointer is destroyed. This function can be
+         * called concurrently by several threads.
+         * @param key the key identifying the environments that are interchangeable
+         * @param loader the function loading a new environment
+         * @return the environment.
+         */
+        std::shared_ptr<hopi::environments::Environment> acquire(const std::string &key, const EnvLoader &loader);
+
+        /**
+         * Getter.
+         * @return the number of environments acquired without being loaded.
+         */
+        [[nodiscard]] uint64_t hits() const;
+
+        /**
+         * Getter.
+         * @return the number of environments loaded.
+         */
+        [[nodiscard]] uint64_t misses() const;
+
+    private:
+        std::map<std::string, std::vector<std::shared_ptr<hopi::environments::Environment>>> envs;
+        uint64_t nb_hits = 0;
+        uint64_t nb_misses = 0;
+        mutable std::mutex mutex;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_ENVIRONMENT_POOL_H
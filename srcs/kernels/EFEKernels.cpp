@@ -0,0 +1,543 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <cmath>
+#include <limits>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include <immintrin.h>
+#include <torch/torch.h>
+#include "EFEKernels.h"
+
+using namespace torch;
+
+namespace experiments::kernels {
+
+    namespace {
+
+        //
+        // LibTorch kernels, used as a reference.
+        //
+
+        Tensor wrap(const float *x, int n) {
+            return from_blob(const_cast<float *>(x), {n}, dtype(kFloat32));
+        }
+
+        void copy(const Tensor &tensor, float *y, int n) {
+            Tensor contiguous = tensor.contiguous();
+            std::memcpy(y, contiguous.data_ptr<float>(), n * sizeof(float));
+        }
+
+        void torchLog(const float *x, float *y, int n) {
+            copy(wrap(x, n).log(), y, n);
+        }
+
+        void torchSoftmax(const float *x, float *y, int n) {
+            copy(softmax(wrap(x, n), 0), y, n);
+        }
+
+        void torchLogSoftmax(const float *x, float *y, int n) {
+            copy(log_softmax(wrap(x, n), 0), y, n);
+        }
+
+        float torchKl(const float *q, const float *p, int n) {
+            Tensor tq = wrap(q, n);
+            Tensor terms = tq * (tq.log() - wrap(p, n).log());
+            return where(tq > 0, terms, zeros_like(terms)).sum().item<float>();
+        }
+
+        float torchEntropy(const float *q, int n) {
+            Tensor tq = wrap(q, n);
+            Tensor terms = tq * tq.log();
+            return -where(tq > 0, terms, zeros_like(terms)).sum().item<float>();
+        }
+
+        float torchDot(const float *a, const float *b, int n) {
+            return (wrap(a, n) * wrap(b, n)).sum().item<float>();
+        }
+
+        //
+        // Scalar kernels, used when the CPU has no vector extension.
+        //
+
+        void scalarLog(const float *x, float *y, int n) {
+            for (int i = 0; i < n; ++i) {
+                y[i] = std::log(x[i]);
+            }
+        }
+
+        void scalarSoftmax(const float *x, float *y, int n) {
+            float max = -std::numeric_limits<float>::infinity();
+            for (int i = 0; i < n; ++i) {
+                max = std::max(max, x[i]);
+            }
+            float sum = 0;
+            for (int i = 0; i < n; ++i) {
+                y[i] = std::exp(x[i] - max);
+                sum += y[i];
+            }
+            for (int i = 0; i < n; ++i) {
+                y[i] /= sum;
+            }
+        }
+
+        void scalarLogSoftmax(const float *x, float *y, int n) {
+            float max = -std::numeric_limits<float>::infinity();
+            for (int i = 0; i < n; ++i) {
+                max = std::max(max, x[i]);
+            }
+            float sum = 0;
+            for (int i = 0; i < n; ++i) {
+                sum += std::exp(x[i] - max);
+            }
+            float shift = max + std::log(sum);
+            for (int i = 0; i < n; ++i) {
+                y[i] = x[i] - shift;
+            }
+        }
+
+        float scalarKl(const float *q, const float *p, int n) {
+            float kl = 0;
+            for (int i = 0; i < n; ++i) {
+                if (q[i] > 0)
+                    kl += q[i] * (std::log(q[i]) - std::log(p[i]));
+            }
+            return kl;
+        }
+
+        float scalarEntropy(const float *q, int n) {
+            float entropy = 0;
+            for (int i = 0; i < n; ++i) {
+                if (q[i] > 0)
+                    entropy -= q[i] * std::log(q[i]);
+            }
+            return entropy;
+        }
+
+        float scalarDot(const float *a, const float *b, int n) {
+            float dot = 0;
+            for (int i = 0; i < n; ++i) {
+                dot += a[i] * b[i];
+            }
+            return dot;
+        }
+
+        //
+        // AVX2 kernels, the logarithm and exponential are the Cephes single-precision approximations.
+        //
+
+        #define AVX2_TARGET __attribute__((target("avx2,fma")))
+
+        AVX2_TARGET inline __m256 log256(__m256 x) {
+            const __m256 one = _mm256_set1_ps(1.0f);
+            __m256 zero_mask = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_EQ_OQ);
+            __m256 nan_mask = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_NGE_UQ);
+            __m256 inf_mask = _mm256_cmp_ps(x, _mm256_set1_ps(INFINITY), _CMP_EQ_OQ);
+
+            // Split x into a mantissa in [sqrt(1/2), sqrt(2)) and an exponent.
+            x = _mm256_max_ps(x, _mm256_set1_ps(std::numeric_limits<float>::min()));
+            __m256i exponent = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_castps_si256(x), 23), _mm256_set1_epi32(0x7f));
+            x = _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(~0x7f800000)));
+            x = _mm256_or_ps(x, _mm256_set1_ps(0.5f));
+            __m256 e = _mm256_add_ps(_mm256_cvtepi32_ps(exponent), one);
+            __m256 mask = _mm256_cmp_ps(x, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OS);
+            __m256 tmp = _mm256_and_ps(x, mask);
+            x = _mm256_sub_ps(x, one);
+            e = _mm256_sub_ps(e, _mm256_and_ps(one, mask));
+            x = _mm256_add_ps(x, tmp);
+
+            // Evaluate the polynomial approximation of log(1 + x).
+            __m256 z = _mm256_mul_ps(x, x);
+            __m256 y = _mm256_set1_ps(7.0376836292E-2f);
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(-1.1514610310E-1f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.1676998740E-1f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(-1.2420140846E-1f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.4249322787E-1f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(-1.6668057665E-1f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(2.0000714765E-1f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(-2.4999993993E-1f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(3.3333331174E-1f));
+            y = _mm256_mul_ps(_mm256_mul_ps(y, x), z);
+            y = _mm256_fmadd_ps(e, _mm256_set1_ps(-2.12194440e-4f), y);
+            y = _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), y);
+            x = _mm256_add_ps(x, y);
+            x = _mm256_fmadd_ps(e, _mm256_set1_ps(0.693359375f), x);
+
+            // Handle the special values.
+            x = _mm256_blendv_ps(x, _mm256_set1_ps(-INFINITY), zero_mask);
+            x = _mm256_blendv_ps(x, _mm256_set1_ps(INFINITY), inf_mask);
+            return _mm256_blendv_ps(x, _mm256_set1_ps(NAN), nan_mask);
+        }
+
+        AVX2_TARGET inline __m256 exp256(__m256 x) {
+            x = _mm256_min_ps(x, _mm256_set1_ps(88.3762626647949f));
+            x = _mm256_max_ps(x, _mm256_set1_ps(-88.3762626647949f));
+
+            // Compute exp(x) = 2^n * exp(r), where n = round(x / log(2)) and r = x - n * log(2).
+            __m256 n = _mm256_floor_ps(_mm256_fmadd_ps(x, _mm256_set1_ps(1.44269504088896341f), _mm256_set1_ps(0.5f)));
+            x = _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375f), x);
+            x = _mm256_fnmadd_ps(n, _mm256_set1_ps(-2.12194440e-4f), x);
+            __m256 z = _mm256_mul_ps(x, x);
+            __m256 y = _mm256_set1_ps(1.9875691500E-4f);
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.3981999507E-3f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(8.3334519073E-3f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(4.1665795894E-2f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.6666665459E-1f));
+            y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(5.0000001201E-1f));
+            y = _mm256_fmadd_ps(y, z, x);
+            y = _mm256_add_ps(y, _mm256_set1_ps(1.0f));
+            __m256i pow2n = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(n), _mm256_set1_epi32(0x7f)), 23);
+            return _mm256_mul_ps(y, _mm256_castsi256_ps(pow2n));
+        }
+
+        AVX2_TARGET inline float sum256(__m256 x) {
+            __m128 sum = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+            sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+            sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+            return _mm_cvtss_f32(sum);
+        }
+
+        AVX2_TARGET inline float max256(__m256 x) {
+            __m128 max = _mm_max_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+            max = _mm_max_ps(max, _mm_movehl_ps(max, max));
+            max = _mm_max_ss(max, _mm_movehdup_ps(max));
+            return _mm_cvtss_f32(max);
+        }
+
+        AVX2_TARGET void avx2Log(const float *x, float *y, int n) {
+            int i = 0;
+            for (; i + 8 <= n; i += 8) {
+                _mm256_storeu_ps(y + i, log256(_mm256_loadu_ps(x + i)));
+            }
+            scalarLog(x + i, y + i, n - i);
+        }
+
+        AVX2_TARGET float avx2Max(const float *x, int n) {
+            int i = 0;
+            __m256 max = _mm256_set1_ps(-INFINITY);
+            for (; i + 8 <= n; i += 8) {
+                max = _mm256_max_ps(max, _mm256_loadu_ps(x + i));
+            }
+            float result = max256(max);
+            for (; i < n; ++i) {
+                result = std::max(result, x[i]);
+            }
+            return result;
+        }
+
+        AVX2_TARGET void avx2Softmax(const float *x, float *y, int n) {
+            float max = avx2Max(x, n);
+            int i = 0;
+            __m256 shift = _mm256_set1_ps(max);
+            __m256 sum = _mm256_setzero_ps();
+            for (; i + 8 <= n; i += 8) {
+                __m256 e = exp256(_mm256_sub_ps(_mm256_loadu_ps(x + i), shift));
+                _mm256_storeu_ps(y + i, e);
+                sum = _mm256_add_ps(sum, e);
+            }
+            float total = sum256(sum);
+            for (; i < n; ++i) {
+                y[i] = std::exp(x[i] - max);
+                total += y[i];
+            }
+            __m256 scale = _mm256_set1_ps(1.0f / total);
+            for (i = 0; i + 8 <= n; i += 8) {
+                _mm256_storeu_ps(y + i, _mm256_mul_ps(_mm256_loadu_ps(y + i), scale));
+            }
+            for (; i < n; ++i) {
+                y[i] /= total;
+            }
+        }
+
+        AVX2_TARGET void avx2LogSoftmax(const float *x, float *y, int n) {
+            float max = avx2Max(x, n);
+            int i = 0;
+            __m256 sum = _mm256_setzero_ps();
+            for (; i + 8 <= n; i += 8) {
+                sum = _mm256_add_ps(sum, exp256(_mm256_sub_ps(_mm256_loadu_ps(x + i), _mm256_set1_ps(max))));
+            }
+            float total = sum256(sum);
+            for (; i < n; ++i) {
+                total += std::exp(x[i] - max);
+            }
+            float shift = max + std::log(total);
+            for (i = 0; i + 8 <= n; i += 8) {
+                _mm256_storeu_ps(y + i, _mm256_sub_ps(_mm256_loadu_ps(x + i), _mm256_set1_ps(shift)));
+            }
+            for (; i < n; ++i) {
+                y[i] = x[i] - shift;
+            }
+        }
+
+        AVX2_TARGET float avx2Kl(const float *q, const float *p, int n) {
+            int i = 0;
+            __m256 sum = _mm256_setzero_ps();
+            for (; i + 8 <= n; i += 8) {
+                __m256 vq = _mm256_loadu_ps(q + i);
+                __m256 terms = _mm256_mul_ps(vq, _mm256_sub_ps(log256(vq), log256(_mm256_loadu_ps(p + i))));
+                __m256 positive = _mm256_cmp_ps(vq, _mm256_setzero_ps(), _CMP_GT_OQ);
+                sum = _mm256_add_ps(sum, _mm256_and_ps(terms, positive));
+            }
+            return sum256(sum) + scalarKl(q + i, p + i, n - i);
+        }
+
+        AVX2_TARGET float avx2Entropy(const float *q, int n) {
+            int i = 0;
+            __m256 sum = _mm256_setzero_ps();
+            for (; i + 8 <= n; i += 8) {
+                __m256 vq = _mm256_loadu_ps(q + i);
+                __m256 positive = _mm256_cmp_ps(vq, _mm256_setzero_ps(), _CMP_GT_OQ);
+                sum = _mm256_add_ps(sum, _mm256_and_ps(_mm256_mul_ps(vq, log256(vq)), positive));
+            }
+            return -sum256(sum) + scalarEntropy(q + i, n - i);
+        }
+
+        AVX2_TARGET float avx2Dot(const float *a, const float *b, int n) {
+            int i = 0;
+            __m256 sum = _mm256_setzero_ps();
+            for (; i + 8 <= n; i += 8) {
+                sum = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum);
+            }
+            return sum256(sum) + scalarDot(a + i, b + i, n - i);
+        }
+
+        //
+        // AVX-512 kernels, the last elements are processed with masked loads and stores.
+        //
+
+        #define AVX512_TARGET __attribute__((target("avx512f")))
+
+        AVX512_TARGET inline __mmask16 tail512(int remaining) {
+            return (remaining >= 16) ? (__mmask16) 0xffff : (__mmask16) ((1u << remaining) - 1);
+        }
+
+        AVX512_TARGET inline __m512 log512(__m512 x) {
+            const __m512 one = _mm512_set1_ps(1.0f);
+            __mmask16 zero_mask = _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_EQ_OQ);
+            __mmask16 nan_mask = _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_NGE_UQ);
+            __mmask16 inf_mask = _mm512_cmp_ps_mask(x, _mm512_set1_ps(INFINITY), _CMP_EQ_OQ);
+
+            // Split x into a mantissa in [sqrt(1/2), sqrt(2)) and an exponent.
+            x = _mm512_max_ps(x, _mm512_set1_ps(std::numeric_limits<float>::min()));
+            __m512i exponent = _mm512_sub_epi32(_mm512_srli_epi32(_mm512_castps_si512(x), 23), _mm512_set1_epi32(0x7f));
+            x = _mm512_castsi512_ps(_mm512_or_si512(
+                _mm512_and_si512(_mm512_castps_si512(x), _mm512_set1_epi32(~0x7f800000)),
+                _mm512_castps_si512(_mm512_set1_ps(0.5f))
+            ));
+            __m512 e = _mm512_add_ps(_mm512_cvtepi32_ps(exponent), one);
+            __mmask16 mask = _mm512_cmp_ps_mask(x, _mm512_set1_ps(0.707106781186547524f), _CMP_LT_OS);
+            x = _mm512_mask_add_ps(_mm512_sub_ps(x, one), mask, _mm512_sub_ps(x, one), x);
+            e = _mm512_mask_sub_ps(e, mask, e, one);
+
+            // Evaluate the polynomial approximation of log(1 + x).
+            __m512 z = _mm512_mul_ps(x, x);
+            __m512 y = _mm512_set1_ps(7.0376836292E-2f);
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-1.1514610310E-1f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.1676998740E-1f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-1.2420140846E-1f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.4249322787E-1f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-1.6668057665E-1f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(2.0000714765E-1f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(-2.4999993993E-1f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(3.3333331174E-1f));
+            y = _mm512_mul_ps(_mm512_mul_ps(y, x), z);
+            y = _mm512_fmadd_ps(e, _mm512_set1_ps(-2.12194440e-4f), y);
+            y = _mm512_fnmadd_ps(z, _mm512_set1_ps(0.5f), y);
+            x = _mm512_add_ps(x, y);
+            x = _mm512_fmadd_ps(e, _mm512_set1_ps(0.693359375f), x);
+
+            // Handle the special values.
+            x = _mm512_mask_blend_ps(zero_mask, x, _mm512_set1_ps(-INFINITY));
+            x = _mm512_mask_blend_ps(inf_mask, x, _mm512_set1_ps(INFINITY));
+            return _mm512_mask_blend_ps(nan_mask, x, _mm512_set1_ps(NAN));
+        }
+
+        AVX512_TARGET inline __m512 exp512(__m512 x) {
+            x = _mm512_min_ps(x, _mm512_set1_ps(88.3762626647949f));
+            x = _mm512_max_ps(x, _mm512_set1_ps(-88.3762626647949f));
+
+            // Compute exp(x) = 2^n * exp(r), where n = round(x / log(2)) and r = x - n * log(2).
+            __m512 n = _mm512_roundscale_ps(
+                _mm512_fmadd_ps(x, _mm512_set1_ps(1.44269504088896341f), _mm512_set1_ps(0.5f)),
+                _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC
+            );
+            x = _mm512_fnmadd_ps(n, _mm512_set1_ps(0.693359375f), x);
+            x = _mm512_fnmadd_ps(n, _mm512_set1_ps(-2.12194440e-4f), x);
+            __m512 z = _mm512_mul_ps(x, x);
+            __m512 y = _mm512_set1_ps(1.9875691500E-4f);
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.3981999507E-3f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(8.3334519073E-3f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(4.1665795894E-2f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(1.6666665459E-1f));
+            y = _mm512_fmadd_ps(y, x, _mm512_set1_ps(5.0000001201E-1f));
+            y = _mm512_fmadd_ps(y, z, x);
+            y = _mm512_add_ps(y, _mm512_set1_ps(1.0f));
+            __m512i pow2n = _mm512_slli_epi32(_mm512_add_epi32(_mm512_cvttps_epi32(n), _mm512_set1_epi32(0x7f)), 23);
+            return _mm512_mul_ps(y, _mm512_castsi512_ps(pow2n));
+        }
+
+        AVX512_TARGET void avx512Log(const float *x, float *y, int n) {
+            for (int i = 0; i < n; i += 16) {
+                __mmask16 mask = tail512(n - i);
+                __m512 v = _mm512_mask_loadu_ps(_mm512_set1_ps(1.0f), mask, x + i);
+                _mm512_mask_storeu_ps(y + i, mask, log512(v));
+            }
+        }
+
+        AVX512_TARGET float avx512Max(const float *x, int n) {
+            __m512 max = _mm512_set1_ps(-INFINITY);
+            for (int i = 0; i < n; i += 16) {
+                max = _mm512_max_ps(max, _mm512_mask_loadu_ps(_mm512_set1_ps(-INFINITY), tail512(n - i), x + i));
+            }
+            return _mm512_reduce_max_ps(max);
+        }
+
+        AVX512_TARGET void avx512Softmax(const float *x, float *y, int n) {
+            __m512 shift = _mm512_set1_ps(avx512Max(x, n));
+            __m512 sum = _mm512_setzero_ps();
+            for (int i = 0; i < n; i += 16) {
+                __mmask16 mask = tail512(n - i);
+                __m512 e = exp512(_mm512_sub_ps(_mm512_maskz_loadu_ps(mask, x + i), shift));
+                _mm512_mask_storeu_ps(y + i, mask, e);
+                sum = _mm512_mask_add_ps(sum, mask, sum, e);
+            }
+            __m512 scale = _mm512_set1_ps(1.0f / _mm512_reduce_add_ps(sum));
+            for (int i = 0; i < n; i += 16) {
+                __mmask16 mask = tail512(n - i);
+                _mm512_mask_storeu_ps(y + i, mask, _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, y + i), scale));
+            }
+        }
+
+        AVX512_TARGET void avx512LogSoftmax(const float *x, float *y, int n) {
+            float max = avx512Max(x, n);
+            __m512 sum = _mm512_setzero_ps();
+            for (int i = 0; i < n; i += 16) {
+                __mmask16 mask = tail512(n - i);
+                __m512 e = exp512(_mm512_sub_ps(_mm512_maskz_loadu_ps(mask, x + i), _mm512_set1_ps(max)));
+                sum = _mm512_mask_add_ps(sum, mask, sum, e);
+            }
+            __m512 shift = _mm512_set1_ps(max + std::log(_mm512_reduce_add_ps(sum)));
+            for (int i = 0; i < n; i += 16) {
+                __mmask16 mask = tail512(n - i);
+                _mm512_mask_storeu_ps(y + i, mask, _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, x + i), shift));
+            }
+        }
+
+        AVX512_TARGET float avx512Kl(const float *q, const float *p, int n) {
+            __m512 sum = _mm512_setzero_ps();
+            for (int i = 0; i < n; i += 16) {
+                __mmask16 mask = tail512(n - i);
+                __m512 vq = _mm512_maskz_loadu_ps(mask, q + i);
+                __m512 vp = _mm512_mask_loadu_ps(_mm512_set1_ps(1.0f), mask, p + i);
+                __mmask16 positive = _mm512_mask_cmp_ps_mask(mask, vq, _mm512_setzero_ps(), _CMP_GT_OQ);
+                __m512 terms = _mm512_mul_ps(vq, _mm512_sub_ps(log512(vq), log512(vp)));
+                sum = _mm512_mask_add_ps(sum, positive, sum, terms);
+            }
+            return _mm512_reduce_add_ps(sum);
+        }
+
+        AVX512_TARGET float avx512Entropy(const float *q, int n) {
+            __m512 sum = _mm512_setzero_ps();
+            for (int i = 0; i < n; i += 16) {
+                __mmask16 mask = tail512(n - i);
+                __m512 vq = _mm512_maskz_loadu_ps(mask, q + i);
+                __mmask16 positive = _mm512_mask_cmp_ps_mask(mask, vq, _mm512_setzero_ps(), _CMP_GT_OQ);
+                sum = _mm512_mask_add_ps(sum, positive, sum, _mm512_mul_ps(vq, log512(vq)));
+            }
+            return -_mm512_reduce_add_ps(sum);
+        }
+
+        AVX512_TARGET float avx512Dot(const float *a, const float *b, int n) {
+            __m512 sum = _mm512_setzero_ps();
+            for (int i = 0; i < n; i += 16) {
+                __mmask16 mask = tail512(n - i);
+                sum = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i), sum);
+            }
+            return _mm512_reduce_add_ps(sum);
+        }
+
+        const EFEKernelTable TORCH_KERNELS = {
+            KernelBackend::TORCH, torchLog, torchSoftmax, torchLogSoftmax, torchKl, torchEntropy, torchDot
+        };
+        const EFEKernelTable SCALAR_KERNELS = {
+            KernelBackend::SCALAR, scalarLog, scalarSoftmax, scalarLogSoftmax, scalarKl, scalarEntropy, scalarDot
+        };
+        const EFEKernelTable AVX2_KERNELS = {
+            KernelBackend::AVX2, avx2Log, avx2Softmax, avx2LogSoftmax, avx2Kl, avx2Entropy, avx2Dot
+        };
+        const EFEKernelTable AVX512_KERNELS = {
+            KernelBackend::AVX512, avx512Log, avx512Softmax, avx512LogSoftmax, avx512Kl, avx512Entropy, avx512Dot
+        };
+
+        double relativeError(float value, float reference) {
+            if (std::isinf(reference) && value == reference)
+                return 0;
+            return std::abs((double) value - (double) reference) / (1.0 + std::abs((double) reference));
+        }
+
+    }
+
+    const EFEKernelTable &EFEKernels::table(KernelBackend backend) {
+        switch (backend) {
+            case KernelBackend::TORCH:  return TORCH_KERNELS;
+            case KernelBackend::SCALAR: return SCALAR_KERNELS;
+            case KernelBackend::AVX2:   return AVX2_KERNELS;
+            case KernelBackend::AVX512: return AVX512_KERNELS;
+        }
+        throw std::runtime_error("In EFEKernels::table, unknown backend.");
+    }
+
+    bool EFEKernels::available(KernelBackend backend) {
+        switch (backend) {
+            case KernelBackend::AVX2:   return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+            case KernelBackend::AVX512: return __builtin_cpu_supports("avx512f");
+            default:                    return true;
+        }
+    }
+
+    std::string EFEKernels::name(KernelBackend backend) {
+        switch (backend) {
+            case KernelBackend::TORCH:  return "torch";
+            case KernelBackend::SCALAR: return "scalar";
+            case KernelBackend::AVX2:   return "avx2";
+            case KernelBackend::AVX512: return "avx512";
+        }
+        return "unknown";
+    }
+
+    double EFEKernels::verify(KernelBackend backend, int nb_trials) {
+        if (!available(backend))
+            throw std::runtime_error("In EFEKernels::verify, " + name(backend) + " is not supported by this CPU.");
+        const EFEKernelTable &kernels = table(backend);
+        double max_error = 0;
+        for (int trial = 0; trial < nb_trials; ++trial) {
+            // Draw two distributions, some entries of q are zero to exercise the convention 0 * log(0) = 0.
+            int n = 1 + trial % 67;
+            Tensor logits = 10 * rand({n}, dtype(kFloat32)) - 5;
+            Tensor q = softmax(logits, 0).contiguous();
+            if (trial % 3 == 0)
+                q = where(rand({n}) < 0.2, zeros_like(q), q).contiguous();
+            Tensor p = softmax(10 * rand({n}, dtype(kFloat32)) - 5, 0).contiguous();
+            auto *x = logits.data_ptr<float>();
+            auto *vq = q.data_ptr<float>();
+            auto *vp = p.data_ptr<float>();
+
+            std::vector<float> y(n), reference(n);
+            for (auto kernel : {&EFEKernelTable::log, &EFEKernelTable::softmax, &EFEKernelTable::logSoftmax}) {
+                const float *input = (kernel == &EFEKernelTable::log) ? vp : x;
+                (kernels.*kernel)(input, y.data(), n);
+                (TORCH_KERNELS.*kernel)(input, reference.data(), n);
+                for (int i = 0; i < n; ++i) {
+                    max_error = std::max(max_error, relativeError(y[i], reference[i]));
+                }
+            }
+            max_error = std::max(max_error, relativeError(kernels.kl(vq, vp, n), torchKl(vq, vp, n)));
+            max_error = std::max(max_error, relativeError(kernels.entropy(vq, n), torchEntropy(vq, n)));
+            max_error = std::max(max_error, relativeError(kernels.dot(vq, vp, n), torchDot(vq, vp, n)));
+        }
+        return max_error;
+    }
+
+}
@@ -0,0 +1,66 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_EFE_KERNELS_H
+#define EXPERIMENTS_AI_TS_EFE_KERNELS_H
+
+#include <string>
+#include <ostream>
+
+namespace experiments::kernels {
+
+    // Define the implementations of the EFE kernels that can be selected.
+    enum class KernelBackend {
+        TORCH,
+        SCALAR,
+        AVX2,
+        AVX512
+    };
+
+    // Define the kernels used to evaluate the expected free energy, on contiguous buffers of n floats.
+    struct EFEKernelTable {
+        KernelBackend backend;
+        void (*log)(const float *x, float *y, int n);
+        void (*softmax)(const float *x, float *y, int n);
+        void (*logSoftmax)(const float *x, float *y, int n);
+        float (*kl)(const float *q, const float *p, int n);
+        float (*entropy)(const float *q, int n);
+        float (*dot)(const float *a, const float *b, int n);
+    };
+
+    class EFEKernels {
+    public:
+        /**
+         * Getter.
+         * @param backend the implementation of the kernels
+         * @return the kernels of the backend.
+         */
+        static const EFEKernelTable &table(KernelBackend backend);
+
+        /**
+         * Getter.
+         * @param backend the implementation of the kernels
+         * @return true if the CPU supports the instructions used by the backend, false otherwise.
+         */
+        static bool available(KernelBackend backend);
+
+        /**
+         * Getter.
+         * @param backend the implementation of the kernels
+         * @return the name of the backend.
+         */
+        static std::string name(KernelBackend backend);
+
+        /**
+         * Compare the kernels of a backend to LibTorch on random distributions of various sizes.
+         * @param backend the implementation of the kernels, which must be supported by the CPU
+         * @param nb_trials the number of random distributions
+         * @return the largest error relative to LibTorch, i.e., |x - torch| / (1 + |torch|).
+         */
+        static double verify(KernelBackend backend, int nb_trials = 200);
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_EFE_KERNELS_H
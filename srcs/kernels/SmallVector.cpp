@@ -0,0 +1,32 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <cstring>
+#include <algorithm>
+#include "SmallVector.h"
+
+using namespace torch;
+
+namespace experiments::kernels {
+
+    SmallVector SmallVector::fromTensor(const Tensor &tensor) {
+        Tensor contiguous = tensor.to(kFloat32).contiguous();
+        SmallVector vector((int) contiguous.numel());
+        std::memcpy(vector.data(), contiguous.data_ptr<float>(), vector.size() * sizeof(float));
+        return vector;
+    }
+
+    SmallVector::SmallVector(int size) : n(size) {
+        if (size < 0 || size > CAPACITY)
+            throw std::runtime_error("In SmallVector::SmallVector, the size must be between 0 and CAPACITY.");
+        std::fill_n(values.begin(), n, 0.0f);
+    }
+
+    Tensor SmallVector::toTensor() const {
+        Tensor tensor = zeros({n}, dtype(kFloat32));
+        std::memcpy(tensor.data_ptr<float>(), data(), n * sizeof(float));
+        return tensor;
+    }
+
+}
@@ -0,0 +1,80 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_SMALL_VECTOR_H
+#define EXPERIMENTS_AI_TS_SMALL_VECTOR_H
+
+#include <array>
+#include <torch/torch.h>
+
+namespace experiments::kernels {
+
+    /**
+     * Fixed-capacity vector of floats stored contiguously and aligned on a cache line, so that the EFE kernels can
+     * process the small distributions of the planner (a few dozen states or observations) without going through
+     * the LibTorch dispatcher and allocator.
+     */
+    class SmallVector {
+    public:
+        static constexpr int CAPACITY = 1024;
+
+        /**
+         * Create a small vector from a one-dimensional tensor.
+         * @param tensor the tensor, whose number of elements must not exceed CAPACITY
+         * @return the small vector.
+         */
+        static SmallVector fromTensor(const torch::Tensor &tensor);
+
+        /**
+         * Constructor.
+         * @param size the number of elements, which are initialised to zero
+         */
+        explicit SmallVector(int size = 0);
+
+        /**
+         * Copy the elements in a new tensor.
+         * @return the tensor.
+         */
+        [[nodiscard]] torch::Tensor toTensor() const;
+
+        /**
+         * Getter.
+         * @return the number of elements.
+         */
+        [[nodiscard]] int size() const { return n; }
+
+        /**
+         * Getter.
+         * @return a pointer to the first element.
+         */
+        float *data() { return values.data(); }
+
+        /**
+         * Getter.
+         * @return a pointer to the first element.
+         */
+        [[nodiscard]] const float *data() const { return values.data(); }
+
+        /**
+         * Getter.
+         * @param index the index of the element
+         * @return the element.
+         */
+        float &operator[](int index) { return values[index]; }
+
+        /**
+         * Getter.
+         * @param index the index of the element
+         * @return the element.
+         */
+        float operator[](int index) const { return values[index]; }
+
+    private:
+        alignas(64) std::array<float, CAPACITY> values;
+        int n;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_SMALL_VECTOR_H
@@ -0,0 +1,99 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include "RandomStream.h"
+
+namespace experiments::random {
+
+    namespace {
+        // The multipliers and key increments of Philox4x32.
+        const uint32_t PHILOX_M0 = 0xD2511F53;
+        const uint32_t PHILOX_M1 = 0xCD9E8D57;
+        const uint32_t PHILOX_W0 = 0x9E3779B9;
+        const uint32_t PHILOX_W1 = 0xBB67AE85;
+        const int PHILOX_ROUNDS = 10;
+
+        /**
+         * Mix the bits of a 64-bit number (SplitMix64 finalizer).
+         * @param x the number
+         * @return the mixed number.
+         */
+        uint64_t mix(uint64_t x) {
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+            return x ^ (x >> 31);
+        }
+    }
+
+    RandomStream::RandomStream(uint64_t seed, uint64_t episode, uint64_t stream)
+        : RandomStream(RandomState{seed, episode, stream, 0}) {}
+
+    RandomStream::RandomStream(const RandomState &state) : random_state(state), block() {
+        generate();
+    }
+
+    uint32_t RandomStream::next() {
+        uint32_t number = block[random_state.counter % 4];
+        if (++random_state.counter % 4 == 0)
+            generate();
+        return number;
+    }
+
+    double RandomStream::uniform() {
+        // The two draws are sequenced, the order of evaluation of the operands of ^ being unspecified.
+        uint64_t high_bits = next();
+        uint64_t low_bits = next();
+        return (double) ((high_bits << 21) ^ (low_bits >> 11)) * 0x1.0p-53;
+    }
+
+    RandomState RandomStream::state() const {
+        return random_state;
+    }
+
+    std::array<uint32_t, 4> RandomStream::philox(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) {
+        for (int round = 0; round < PHILOX_ROUNDS; ++round) {
+            uint64_t product0 = (uint64_t) PHILOX_M0 * counter[0];
+            uint64_t product1 = (uint64_t) PHILOX_M1 * counter[2];
+            counter = {
+                (uint32_t) (product1 >> 32) ^ counter[1] ^ key[0], (uint32_t) product1,
+                (uint32_t) (product0 >> 32) ^ counter[3] ^ key[1], (uint32_t) product0
+            };
+            key[0] += PHILOX_W0;
+            key[1] += PHILOX_W1;
+        }
+        return counter;
+    }
+
+    void RandomStream::generate() {
+        // The counter holds the index of the block, the episode and the stream, and the key holds the seed.
+        uint64_t index = random_state.counter / 4;
+        std::array<uint32_t, 4> counter = {
+            (uint32_t) index, (uint32_t) (index >> 32), (uint32_t) random_state.episode, (uint32_t) random_state.stream
+        };
+        uint64_t high_bits = (random_state.episode >> 32) ^ ((random_state.stream >> 32) << 32);
+        uint64_t key = mix(random_state.seed) ^ mix(high_bits);
+        block = philox(counter, {(uint32_t) key, (uint32_t) (key >> 32)});
+    }
+
+    std::unique_ptr<EpisodeStreams> EpisodeStreams::create(uint64_t seed, uint64_t episode) {
+        return std::make_unique<EpisodeStreams>(seed, episode);
+    }
+
+    EpisodeStreams::EpisodeStreams(uint64_t seed, uint64_t episode) {
+        for (uint64_t id = 0; id < (uint64_t) StreamId::NB_STREAMS; ++id) {
+            streams.emplace_back(seed, episode, id);
+        }
+    }
+
+    RandomStream &EpisodeStreams::stream(StreamId id) {
+        return streams.at((std::size_t) id);
+    }
+
+    void EpisodeStreams::seedTorch(StreamId id) {
+        RandomStream &random_stream = stream(id);
+        uint64_t high_bits = random_stream.next();
+        torch::manual_seed((high_bits << 32) | random_stream.next());
+    }
+
+}
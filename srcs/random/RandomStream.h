@@ -0,0 +1,131 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_RANDOM_STREAM_H
+#define EXPERIMENTS_AI_TS_RANDOM_STREAM_H
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <torch/torch.h>
+
+namespace experiments::random {
+
+    // Define the state of a random stream, a stream is fully determined by its key and the number of draws.
+    struct RandomState {
+        uint64_t seed = 0;     // Seed of the experiment.
+        uint64_t episode = 0;  // Index of the episode.
+        uint64_t stream = 0;   // Index of the stream within the episode.
+        uint64_t counter = 0;  // Number of 32-bit numbers drawn from the stream.
+    };
+
+    // Define the streams of an episode, so that the consumers of random numbers do not perturb each other.
+    enum class StreamId : uint64_t {
+        ENVIRONMENT = 0,      // Stochasticity of the environment, e.g., the initial position of the sprite.
+        ACTION_SELECTION = 1, // Sampling of the action performed by the agent.
+        PLANNING = 2,         // Sampling done by the planner, e.g., while breaking ties.
+        NB_STREAMS = 3
+    };
+
+    /**
+     * Counter-based random number generator (Philox4x32-10). The n-th number of a stream is a pure function of the
+     * key (seed, episode, stream) and n, so that an episode draws the same numbers regardless of the thread running
+     * it or of the other episodes, and any episode can be replayed on its own.
+     */
+    class RandomStream {
+    public:
+        /**
+         * Constructor.
+         * @param seed the seed of the experiment
+         * @param episode the index of the episode
+         * @param stream the index of the stream within the episode
+         */
+        RandomStream(uint64_t seed, uint64_t episode, uint64_t stream);
+
+        /**
+         * Constructor.
+         * @param state the state of the stream, e.g., to resume an episode
+         */
+        explicit RandomStream(const RandomState &state);
+
+        /**
+         * Draw a 32-bit number.
+         * @return the number.
+         */
+        uint32_t next();
+
+        /**
+         * Draw a number uniformly in [0, 1), with 53 bits of precision.
+         * @return the number.
+         */
+        double uniform();
+
+        /**
+         * Getter.
+         * @return the state of the stream.
+         */
+        [[nodiscard]] RandomState state() const;
+
+        /**
+         * Compute a block of the Philox4x32-10 generator.
+         * @param counter the counter of the block
+         * @param key the key of the generator
+         * @return the four numbers of the block.
+         */
+        static std::array<uint32_t, 4> philox(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key);
+
+    private:
+        /**
+         * Compute the block of four numbers following the current counter.
+         */
+        void generate();
+
+    private:
+        RandomState random_state;
+        std::array<uint32_t, 4> block;
+    };
+
+    /**
+     * The random streams of an episode. The environments and agents of Homing-Pigeon draw from the global LibTorch
+     * generator, so the runner seeds it from the stream of each call with seedTorch().
+     */
+    class EpisodeStreams {
+    public:
+        /**
+         * Create the random streams of an episode.
+         * @param seed the seed of the experiment
+         * @param episode the index of the episode
+         * @return the random streams.
+         */
+        static std::unique_ptr<EpisodeStreams> create(uint64_t seed, uint64_t episode);
+
+        /**
+         * Constructor.
+         * @param seed the seed of the experiment
+         * @param episode the index of the episode
+         */
+        EpisodeStreams(uint64_t seed, uint64_t episode);
+
+        /**
+         * Getter.
+         * @param id the identifier of the stream
+         * @return the stream.
+         */
+        RandomStream &stream(StreamId id);
+
+        /**
+         * Seed the LibTorch generator with the next 64 bits of a stream, so that the code
+         * drawing from the generator consumes the numbers of the stream, e.g., before resetting an environment.
+         * @param id the identifier of the stream
+         */
+        void seedTorch(StreamId id);
+
+    private:
+        std::vector<RandomStream> streams;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_RANDOM_STREAM_H
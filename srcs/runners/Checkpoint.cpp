@@ -0,0 +1,205 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <cstdio>
+#include <limits>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include "Checkpoint.h"
+
+using namespace experiments::trackers;
+
+namespace experiments::runners {
+
+    namespace {
+        // The first line of a checkpoint file, followed by the version of the format.
+        const std::string MAGIC = "BTAI_CHECKPOINT";
+        const int VERSION = 1;
+
+        /**
+         * Read a key of the checkpoint file, and check that it is the expected one.
+         * @param input the stream from which the key should be read
+         * @param key the expected key
+         * @param file_name the name of the checkpoint file, used in error messages
+         */
+        void expect(std::istream &input, const std::string &key, const std::string &file_name) {
+            std::string read;
+            if (!(input >> read) || read != key)
+                throw std::runtime_error("In Checkpoint::load, expected " + key + " in " + file_name + ".");
+        }
+
+        /**
+         * Flush a file to the disk, so that it is complete before being renamed over the previous checkpoint.
+         * @param file_name the name of the file
+         * @return true if the file was flushed, false otherwise.
+         */
+        bool flush(const std::string &file_name) {
+            int fd = ::open(file_name.c_str(), O_RDONLY);
+            if (fd < 0)
+                return false;
+            bool flushed = (::fsync(fd) == 0);
+            ::close(fd);
+            return flushed;
+        }
+    }
+
+    std::unique_ptr<Checkpoint> Checkpoint::create(
+        const std::string &file_name,
+        std::unique_ptr<PerformanceTracker> perf_tracker,
+        const Configuration &configuration,
+        uint64_t seed,
+        int first_episode,
+        int nb_simulations,
+        std::chrono::milliseconds interval
+    ) {
+        return std::make_unique<Checkpoint>(
+            file_name, std::move(perf_tracker), configuration, seed, first_episode, nb_simulations, interval
+        );
+    }
+
+    Checkpoint::Checkpoint(
+        std::string file_name,
+        std::unique_ptr<PerformanceTracker> perf_tracker,
+        Configuration configuration,
+        uint64_t seed,
+        int first_episode,
+        int nb_simulations,
+        std::chrono::milliseconds interval
+    ) : file_name(std::move(file_name)), perf_tracker(std::move(perf_tracker)), time_tracker(TimeTracker::create()),
+        configuration(std::move(configuration)), seed(seed), first_episode(first_episode),
+        done(std::max(0, nb_simulations), false), nb_completed(0), interval(interval),
+        last_write(std::chrono::steady_clock::now()) {
+        this->perf_tracker->reset();
+    }
+
+    bool Checkpoint::load() {
+        if (nb_completed != 0)
+            throw std::runtime_error("In Checkpoint::load, episodes have already been recorded.");
+        std::ifstream input(file_name);
+        if (!input.is_open())
+            return false;
+
+        // Check that the checkpoint was written by the same experiment.
+        int version = 0;
+        expect(input, MAGIC, file_name);
+        input >> version;
+        if (version != VERSION)
+            throw std::runtime_error("In Checkpoint::load, unsupported version in " + file_name + ".");
+        std::size_t nb_entries = 0;
+        expect(input, "configuration", file_name);
+        input >> nb_entries;
+        if (!input || nb_entries != configuration.size())
+            throw std::runtime_error("In Checkpoint::load, " + file_name + " has a different configuration.");
+        for (auto &[name, value] : configuration) {
+            std::string saved_name, saved_value;
+            input >> std::quoted(saved_name) >> std::quoted(saved_value);
+            if (saved_name != name || saved_value != value)
+                throw std::runtime_error(
+                    "In Checkpoint::load, " + file_name + " was written with " + saved_name + " = " + saved_value + "."
+                );
+        }
+        uint64_t saved_seed = 0;
+        int saved_first_episode = 0;
+        std::size_t saved_nb_simulations = 0;
+        expect(input, "seed", file_name);
+        input >> saved_seed;
+        expect(input, "first_episode", file_name);
+        input >> saved_first_episode;
+        expect(input, "nb_simulations", file_name);
+        input >> saved_nb_simulations;
+        if (saved_seed != seed || saved_first_episode != first_episode || saved_nb_simulations != done.size())
+            throw std::runtime_error("In Checkpoint::load, " + file_name + " was written for other episodes.");
+
+        // Read the completed episodes, and the state of the trackers.
+        int nb_saved = 0;
+        expect(input, "completed", file_name);
+        input >> nb_saved;
+        std::vector<bool> saved_done(done.size(), false);
+        for (int i = 0; input && i < nb_saved; ++i) {
+            int episode = 0;
+            input >> episode;
+            if (episode < first_episode || episode - first_episode >= (int) done.size())
+                throw std::runtime_error("In Checkpoint::load, invalid episode in " + file_name + ".");
+            if (saved_done[episode - first_episode])
+                throw std::runtime_error("In Checkpoint::load, repeated episode in " + file_name + ".");
+            saved_done[episode - first_episode] = true;
+        }
+        expect(input, "performance", file_name);
+        perf_tracker->load(input);
+        expect(input, "time", file_name);
+        time_tracker->load(input);
+        if (!input)
+            throw std::runtime_error("In Checkpoint::load, " + file_name + " is truncated.");
+        done = std::move(saved_done);
+        nb_completed = nb_saved;
+        return true;
+    }
+
+    void Checkpoint::save() {
+        write();
+    }
+
+    void Checkpoint::restore(PerformanceTracker &perf, TimeTracker &time) const {
+        perf.merge(*perf_tracker);
+        time.merge(*time_tracker);
+    }
+
+    void Checkpoint::record(int episode, std::shared_ptr<hopi::environments::Environment> &env, uint64_t duration_ns) {
+        int index = episode - first_episode;
+        if (index < 0 || index >= (int) done.size() || done[index])
+            throw std::runtime_error("In Checkpoint::record, invalid or already completed episode.");
+        done[index] = true;
+        ++nb_completed;
+        perf_tracker->track(env);
+        time_tracker->record(duration_ns);
+        if (std::chrono::steady_clock::now() - last_write >= interval)
+            write();
+    }
+
+    bool Checkpoint::completed(int episode) const {
+        int index = episode - first_episode;
+        return index >= 0 && index < (int) done.size() && done[index];
+    }
+
+    int Checkpoint::nbCompleted() const {
+        return nb_completed;
+    }
+
+    void Checkpoint::write() {
+        // Write a temporary file, so that a process killed while writing leaves the previous checkpoint intact.
+        std::string tmp_file_name = file_name + ".tmp";
+        std::ofstream output(tmp_file_name, std::ios::trunc);
+        if (!output.is_open())
+            throw std::runtime_error("In Checkpoint::write, could not open " + tmp_file_name + ".");
+        output << std::setprecision(std::numeric_limits<double>::max_digits10);
+        output << MAGIC << ' ' << VERSION << '\n';
+        output << "configuration " << configuration.size() << '\n';
+        for (auto &[name, value] : configuration) {
+            output << std::quoted(name) << ' ' << std::quoted(value) << '\n';
+        }
+        output << "seed " << seed << '\n';
+        output << "first_episode " << first_episode << '\n';
+        output << "nb_simulations " << done.size() << '\n';
+        output << "completed " << nb_completed;
+        for (std::size_t i = 0; i < done.size(); ++i) {
+            if (done[i])
+                output << ' ' << first_episode + (int) i;
+        }
+        output << '\n' << "performance ";
+        perf_tracker->save(output);
+        output << '\n' << "time ";
+        time_tracker->save(output);
+        output << '\n';
+        output.close();
+        if (!output || !flush(tmp_file_name))
+            throw std::runtime_error("In Checkpoint::write, could not write " + tmp_file_name + ".");
+        if (std::rename(tmp_file_name.c_str(), file_name.c_str()) != 0)
+            throw std::runtime_error("In Checkpoint::write, could not rename " + tmp_file_name + ".");
+        last_write = std::chrono::steady_clock::now();
+    }
+
+}
@@ -0,0 +1,133 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_CHECKPOINT_H
+#define EXPERIMENTS_AI_TS_CHECKPOINT_H
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include "trackers/PerformanceTracker.h"
+#include "trackers/TimeTracker.h"
+
+namespace experiments::runners {
+
+    /**
+     * Checkpoint of an experiment, i.e., the indices of the completed episodes along with the state of the
+     * performance and time trackers restricted to these episodes. The random streams of an episode are keyed by the
+     * seed of the experiment and the index of the episode, so the seed is all that is needed to resume them. The
+     * checkpoint is written to a temporary file which then replaces the previous checkpoint, so a process killed
+     * while writing leaves the previous checkpoint intact.
+     */
+    class Checkpoint {
+    public:
+        // Define a type representing the configuration of an experiment, as a list of (name, value) pairs.
+        typedef std::vector<std::pair<std::string, std::string>> Configuration;
+
+    public:
+        /**
+         * Create a checkpoint.
+         * @param file_name the name of the checkpoint file
+         * @param perf_tracker a fresh performance tracker of the same type as the experiment's performance tracker
+         * @param configuration the configuration of the experiment, which must match when resuming
+         * @param seed the seed of the experiment
+         * @param first_episode the index of the first episode
+         * @param nb_simulations the number of episodes of the experiment
+         * @param interval the minimum time between two checkpoints written during the experiment
+         * @return the checkpoint.
+         */
+        static std::unique_ptr<Checkpoint> create(
+            const std::string &file_name,
+            std::unique_ptr<trackers::PerformanceTracker> perf_tracker,
+            const Configuration &configuration,
+            uint64_t seed,
+            int first_episode,
+            int nb_simulations,
+            std::chrono::milliseconds interval
+        );
+
+        /**
+         * Constructor.
+         * @param file_name the name of the checkpoint file
+         * @param perf_tracker a fresh performance tracker of the same type as the experiment's performance tracker
+         * @param configuration the configuration of the experiment, which must match when resuming
+         * @param seed the seed of the experiment
+         * @param first_episode the index of the first episode
+         * @param nb_simulations the number of episodes of the experiment
+         * @param interval the minimum time between two checkpoints written during the experiment
+         */
+        Checkpoint(
+            std::string file_name,
+            std::unique_ptr<trackers::PerformanceTracker> perf_tracker,
+            Configuration configuration,
+            uint64_t seed,
+            int first_episode,
+            int nb_simulations,
+            std::chrono::milliseconds interval
+        );
+
+        /**
+         * Load the last checkpoint written by an interrupted run of the same experiment, if any.
+         * @return true if a checkpoint was loaded, false if there was none.
+         */
+        bool load();
+
+        /**
+         * Write the checkpoint.
+         */
+        void save();
+
+        /**
+         * Add the performance and execution times of the completed episodes to the trackers of the experiment.
+         * @param perf_tracker the performance tracker of the experiment
+         * @param time_tracker the time tracker of the experiment
+         */
+        void restore(trackers::PerformanceTracker &perf_tracker, trackers::TimeTracker &time_tracker) const;
+
+        /**
+         * Record a completed episode, and write the checkpoint if the interval has elapsed since the last write.
+         * @param episode the index of the episode
+         * @param env the environment in which the episode was run
+         * @param duration_ns the execution time of the episode in nanoseconds
+         */
+        void record(int episode, std::shared_ptr<hopi::environments::Environment> &env, uint64_t duration_ns);
+
+        /**
+         * Getter.
+         * @param episode the index of the episode
+         * @return true if the episode was completed, false otherwise.
+         */
+        [[nodiscard]] bool completed(int episode) const;
+
+        /**
+         * Getter.
+         * @return the number of completed episodes.
+         */
+        [[nodiscard]] int nbCompleted() const;
+
+    private:
+        /**
+         * Write the checkpoint.
+         */
+        void write();
+
+    private:
+        std::string file_name;
+        std::unique_ptr<trackers::PerformanceTracker> perf_tracker;
+        std::unique_ptr<trackers::TimeTracker> time_tracker;
+        Configuration configuration;
+        uint64_t seed;
+        int first_episode;
+        std::vector<bool> done;
+        int nb_completed;
+        std::chrono::milliseconds interval;
+        std::chrono::steady_clock::time_point last_write;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_CHECKPOINT_H
@@ -0,0 +1,38 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <stdexcept>
+#include "CommandLine.h"
+
+namespace experiments::runners {
+
+    CommandLine::CommandLine(int argc, char *argv[], const std::set<std::string> &known) {
+        for (int i = 1; i < argc; ++i) {
+            std::string argument(argv[i]);
+            if (argument.rfind("--", 0) != 0) {
+                positionals.push_back(argument);
+                continue;
+            }
+            auto separator = argument.find('=');
+            std::string name = argument.substr(2, (separator == std::string::npos) ? std::string::npos : separator - 2);
+            if (known.find(name) == known.end())
+                throw std::runtime_error("In CommandLine::CommandLine, unknown option: --" + name + ".");
+            options[name] = (separator == std::string::npos) ? "" : argument.substr(separator + 1);
+        }
+    }
+
+    std::string CommandLine::positional(int index, const std::string &default_value) const {
+        return (index < positionals.size()) ? positionals[index] : default_value;
+    }
+
+    std::string CommandLine::option(const std::string &name, const std::string &default_value) const {
+        auto it = options.find(name);
+        return (it == options.end() || it->second.empty()) ? default_value : it->second;
+    }
+
+    bool CommandLine::has(const std::string &name) const {
+        return options.find(name) != options.end();
+    }
+
+}
@@ -0,0 +1,59 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_COMMAND_LINE_H
+#define EXPERIMENTS_AI_TS_COMMAND_LINE_H
+
+#include <set>
+#include <map>
+#include <vector>
+#include <string>
+
+namespace experiments::runners {
+
+    /**
+     * Arguments of an experiment, i.e., positional arguments and options of the form --name or --name=value.
+     * An option that the experiment does not know is rejected, rather than silently ignored.
+     */
+    class CommandLine {
+    public:
+        /**
+         * Constructor.
+         * @param argc the number of arguments
+         * @param argv the arguments
+         * @param known the names of the options known by the experiment, without the leading dashes
+         */
+        CommandLine(int argc, char *argv[], const std::set<std::string> &known);
+
+        /**
+         * Getter.
+         * @param index the index of the positional argument
+         * @param default_value the value returned when the argument is missing
+         * @return the positional argument.
+         */
+        [[nodiscard]] std::string positional(int index, const std::string &default_value) const;
+
+        /**
+         * Getter.
+         * @param name the name of the option without the leading dashes
+         * @param default_value the value returned when the option is missing or has no value
+         * @return the value of the option.
+         */
+        [[nodiscard]] std::string option(const std::string &name, const std::string &default_value) const;
+
+        /**
+         * Getter.
+         * @param name the name of the option without the leading dashes
+         * @return true if the option is present, false otherwise.
+         */
+        [[nodiscard]] bool has(const std::string &name) const;
+
+    private:
+        std::vector<std::string> positionals;
+        std::map<std::string, std::string> options;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_COMMAND_LINE_H
@@ -0,0 +1,163 @@
+//
+// Created by Theophile Champion on 01/07/2021.
+//
+
+#include <map>
+#include <stdexcept>
+#include <environments/GraphEnv.h>
+#include <environments/MazeEnv.h>
+#include <environments/FrozenLakeEnv.h>
+#include <environments/DisentangleSpritesEnv.h>
+#include "EnvironmentFactory.h"
+#include "trackers/GraphPerformanceTracker.h"
+#include "trackers/MazePerformanceTracker.h"
+#include "trackers/FrozenLakePerformanceTracker.h"
+#include "trackers/SpritesPerformanceTracker.h"
+
+using namespace hopi::environments;
+using namespace experiments::trackers;
+using namespace std;
+
+namespace experiments::runners {
+
+    vector<pair<int, int>> getLocalMinima(const std::string &key) {
+        static const map<string, vector<pair<int, int>>> map {
+                {"1.maze", {{3,4}}},
+                {"5.maze", {{3,3}}},
+                {"9.maze", {{3,5},{5,3}}}
+        };
+        auto it = map.find(key);
+        return (it == map.end()) ? vector<pair<int, int>>() : it->second;
+    }
+
+    EPT_Pair getMazeEnvAndPerfTracker(const EnvironmentOptions &options, ostream &file) {
+        // Maze environment hyper-parameters
+        string MAZES_PATH = "../Homing-Pigeon/examples/mazes/";
+        string MAZE_FILE_NAME = options.maze_file_name;
+        string FULL_MAZE_FILE_NAME = MAZES_PATH + MAZE_FILE_NAME;
+        vector<pair<int,int>> LOCAL_MINIMA = getLocalMinima(MAZE_FILE_NAME);
+
+        // Create the environment and performance tracker.
+        shared_ptr<Environment> env = MazeEnv::create(FULL_MAZE_FILE_NAME);
+        unique_ptr<PerformanceTracker> perf_tracker = MazePerformanceTracker::create(LOCAL_MINIMA);
+
+        // Log the loaded environment.
+        file << "MAZE_FILE_NAME: " << MAZE_FILE_NAME << endl;
+        file << "LOCAL_MINIMA: " << LOCAL_MINIMA << endl;
+
+        return make_pair<>(env, move(perf_tracker));
+    }
+
+    EPT_Pair getGraphEnvAndPerfTracker(const EnvironmentOptions &options, ostream &file) {
+        // Hyper-parameters of the graph environment.
+        int NB_GOOD_PATHS = options.nb_good_paths;
+        int NB_BAD_PATHS = options.nb_bad_paths;
+        vector<int> GOOD_PATHS_SIZES = options.good_paths_sizes;
+
+        // Create the environment and performance tracker.
+        shared_ptr<Environment> env = GraphEnv::create(NB_GOOD_PATHS, NB_BAD_PATHS, GOOD_PATHS_SIZES);
+        unique_ptr<PerformanceTracker> perf_tracker = GraphPerformanceTracker::create();
+
+        // Log the loaded environment.
+        file << "NB_GOOD_PATHS: " << NB_GOOD_PATHS << endl;
+        file << "NB_BAD_PATHS: " << NB_BAD_PATHS << endl;
+        file << "GOOD_PATHS_SIZES: " << GOOD_PATHS_SIZES << endl;
+
+        return make_pair<>(env, move(perf_tracker));
+    }
+
+    EPT_Pair getFrozenLakeEnvAndPerfTracker(const EnvironmentOptions &options, ostream &file) {
+        // Hyper-parameters of the frozen lake environment.
+        string LAKES_PATH = "../Homing-Pigeon/examples/lakes/";
+        string LAKE_FILE_NAME = options.lake_file_name;
+        string FULL_LAKE_FILE_NAME = LAKES_PATH + LAKE_FILE_NAME;
+
+        // Create the environment and performance tracker.
+        shared_ptr<Environment> env = FrozenLakeEnv::create(FULL_LAKE_FILE_NAME);
+        unique_ptr<PerformanceTracker> perf_tracker = FrozenLakePerformanceTracker::create();
+
+        // Log the loaded environment.
+        file << "LAKE_FILE_NAME: " << LAKE_FILE_NAME << endl;
+
+        return make_pair<>(env, move(perf_tracker));
+    }
+
+    EPT_Pair getSpritesEnvAndPerfTracker(const EnvironmentOptions &options, ostream &file) {
+        // Hyper-parameters of the d-sprites environment.
+        string D_SPRITES_PATH = "../Homing-Pigeon/examples/d_sprites/";
+
+        int GRANULARITY = options.granularity; // Granularity of x and y position, i.e., 1, 2, 4, or 8.
+                                               // Granularity of 1 => agent see each position
+                                               // Granularity of 2 => agent see each 2x2 square as a single position
+                                               // ...
+        int REPEAT = options.repeat; // The number of times an action is repeated before the next perception cycle.
+
+        // Create the environment and performance tracker.
+        shared_ptr<Environment> env = DisentangleSpritesEnv::create(D_SPRITES_PATH, GRANULARITY, REPEAT);
+        unique_ptr<PerformanceTracker> perf_tracker = SpritesPerformanceTracker::create();
+
+        // Log the loaded environment.
+        file << "D_SPRITES_FILE_NAME: " << D_SPRITES_PATH << endl;
+        file << "GRANULARITY: " << GRANULARITY << endl;
+        file << "REPEAT: " << REPEAT << endl;
+
+        return make_pair<>(env, move(perf_tracker));
+    }
+
+    EPT_Pair getEnvAndPerfTracker(EnvType type, ostream &file) {
+        return getEnvAndPerfTracker(type, EnvironmentOptions(), file);
+    }
+
+    EPT_Pair getEnvAndPerfTracker(EnvType type, const EnvironmentOptions &options, ostream &file) {
+        static const map<EnvType, EPT_Pair (*)(const EnvironmentOptions &options, ostream &file)> map {
+                {EnvType::MAZE,        &getMazeEnvAndPerfTracker},
+                {EnvType::GRAPH,       &getGraphEnvAndPerfTracker},
+                {EnvType::FROZEN_LAKE, &getFrozenLakeEnvAndPerfTracker},
+                {EnvType::D_SPRITES,   &getSpritesEnvAndPerfTracker}
+        };
+
+        file << "========== ENVIRONMENT CONFIGURATION ==========" << std::endl;
+        auto [env, perf_tracker] = (*map.at(type))(options, file);
+        file << endl;
+        return make_pair<>(env, move(perf_tracker));
+    }
+
+    unique_ptr<PerformanceTracker> getPerfTracker(EnvType type, const EnvironmentOptions &options) {
+        switch (type) {
+            case EnvType::MAZE:
+                return MazePerformanceTracker::create(getLocalMinima(options.maze_file_name));
+            case EnvType::FROZEN_LAKE:
+                return FrozenLakePerformanceTracker::create();
+            case EnvType::D_SPRITES:
+                return SpritesPerformanceTracker::create();
+            default:
+                return GraphPerformanceTracker::create();
+        }
+    }
+
+    EnvType getEnvType(const std::string &name) {
+        static const map<string, EnvType> map {
+                {"maze",    EnvType::MAZE},
+                {"graph",   EnvType::GRAPH},
+                {"lake",    EnvType::FROZEN_LAKE},
+                {"sprites", EnvType::D_SPRITES}
+        };
+
+        auto it = map.find(name);
+        if (it == map.end())
+            throw runtime_error("In getEnvType, unknown environment: " + name + ".");
+        return it->second;
+    }
+
+    string getEnvName(EnvType type) {
+        static const map<EnvType, string> map {
+                {EnvType::MAZE,        "maze"},
+                {EnvType::GRAPH,       "graph"},
+                {EnvType::FROZEN_LAKE, "lake"},
+                {EnvType::D_SPRITES,   "sprites"}
+        };
+
+        return map.at(type);
+    }
+
+}
@@ -0,0 +1,114 @@
+//
+// Created by Theophile Champion on 01/07/2021.
+//
+
+#ifndef EXPERIMENTS_AI_TS_ENVIRONMENT_FACTORY_H
+#define EXPERIMENTS_AI_TS_ENVIRONMENT_FACTORY_H
+
+#include <vector>
+#include <string>
+#include <ostream>
+#include <environments/EnvType.h>
+#include "EpisodeRunner.h"
+
+namespace experiments::runners {
+
+    // Define the hyper-parameters of the environments, the default values are those of the original experiments.
+    struct EnvironmentOptions {
+        std::string maze_file_name = "9.maze";               // Maze loaded from the mazes of Homing-Pigeon.
+        std::string lake_file_name = "5.lake";               // Lake loaded from the lakes of Homing-Pigeon.
+        int nb_good_paths = 3;                               // Number of paths leading to the goal of the graph.
+        int nb_bad_paths = 5;                                // Number of paths leading to the bad state of the graph.
+        std::vector<int> good_paths_sizes = {6, 5, 8};       // Length of the good paths of the graph.
+        int granularity = 4;                                 // Granularity of the x and y positions of dSprites.
+        int repeat = 8;                                      // Number of times a dSprites action is repeated.
+    };
+
+    /**
+     * This function returns the position of the local minimum of the maze whose name is passed as parameters.
+     * @param key the name of maze.
+     * @return a vector containing the local minimum positions.
+     */
+    std::vector<std::pair<int, int>> getLocalMinima(const std::string &key);
+
+    /**
+     * This function returns the environment and performance tracker for the maze environment.
+     * @param options the hyper-parameters of the environment.
+     * @param file in which the loaded environment should be logged.
+     * @return a pair containing the environment and the performance tracker.
+     */
+    EPT_Pair getMazeEnvAndPerfTracker(const EnvironmentOptions &options, std::ostream &file);
+
+    /**
+     * This function returns the environment and performance tracker for the graph environment.
+     * @param options the hyper-parameters of the environment.
+     * @param file in which the loaded environment should be logged.
+     * @return a pair containing the environment and the performance tracker.
+     */
+    EPT_Pair getGraphEnvAndPerfTracker(const EnvironmentOptions &options, std::ostream &file);
+
+    /**
+     * This function returns the environment and performance tracker for the frozen lake environment.
+     * @param options the hyper-parameters of the environment.
+     * @param file in which the loaded environment should be logged.
+     * @return a pair containing the environment and the performance tracker.
+     */
+    EPT_Pair getFrozenLakeEnvAndPerfTracker(const EnvironmentOptions &options, std::ostream &file);
+
+    /**
+     * This function returns the environment and performance tracker for the dSprites environment.
+     * @param options the hyper-parameters of the environment.
+     * @param file in which the loaded environment should be logged.
+     * @return a pair containing the environment and the performance tracker.
+     */
+    EPT_Pair getSpritesEnvAndPerfTracker(const EnvironmentOptions &options, std::ostream &file);
+
+    /**
+     * This function returns the environment in which the agent should be run, and the associated tracker of
+     * performance.
+     * @param type the type of environment.
+     * @param file in which the loaded environment should be described.
+     * @return a pair containing the environment and the performance tracker.
+     */
+    EPT_Pair getEnvAndPerfTracker(hopi::environments::EnvType type, std::ostream &file);
+
+    /**
+     * This function returns the environment in which the agent should be run, and the associated tracker of
+     * performance.
+     * @param type the type of environment.
+     * @param options the hyper-parameters of the environment.
+     * @param file in which the loaded environment should be described.
+     * @return a pair containing the environment and the performance tracker.
+     */
+    EPT_Pair getEnvAndPerfTracker(
+        hopi::environments::EnvType type, const EnvironmentOptions &options, std::ostream &file
+    );
+
+    /**
+     * This function returns the tracker of performance associated with an environment, without loading the
+     * environment, e.g., when the environment is taken from a pool of loaded environments.
+     * @param type the type of environment.
+     * @param options the hyper-parameters of the environment.
+     * @return the performance tracker.
+     */
+    std::unique_ptr<experiments::trackers::PerformanceTracker> getPerfTracker(
+        hopi::environments::EnvType type, const EnvironmentOptions &options
+    );
+
+    /**
+     * This function transform the environment name (string) into the environment type (EnvType).
+     * @param name the environment name.
+     * @return the environment type.
+     */
+    hopi::environments::EnvType getEnvType(const std::string &name);
+
+    /**
+     * This function transform the environment type (EnvType) into the environment name (string).
+     * @param type the environment type.
+     * @return the environment name.
+     */
+    std::string getEnvName(hopi::environments::EnvType type);
+
+}
+
+#endif //EXPERIMENTS_AI_TS_ENVIRONMENT_FACTORY_H
@@ -0,0 +1,182 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <chrono>
+#include <vector>
+#include <graphs/FactorGraph.h>
+#include <environments/Environment.h>
+#include <algorithms/planning/MCTSConfig.h>
+#include <zoo/BTAI.h>
+#include "EpisodeRunner.h"
+#include "Checkpoint.h"
+#include "trackers/PhaseTracker.h"
+#include "trackers/TraceRecorder.h"
+#include "trackers/LiveMetrics.h"
+#include "random/RandomStream.h"
+
+using namespace hopi::environments;
+using namespace hopi::graphs;
+using namespace hopi::zoo;
+using namespace hopi::algorithms::planning;
+using namespace experiments::trackers;
+using namespace experiments::random;
+
+namespace experiments::runners {
+
+    std::unique_ptr<EpisodeRunner> EpisodeRunner::create(
+        EPT_Factory factory,
+        std::shared_ptr<MCTSConfig> config,
+        int nb_simulations,
+        int nb_action_perception_cycles,
+        EvaluationType evaluation_type,
+        uint64_t seed,
+        int first_episode
+    ) {
+        return std::make_unique<EpisodeRunner>(
+            std::move(factory), std::move(config), nb_simulations, nb_action_perception_cycles,
+            evaluation_type, seed, first_episode
+        );
+    }
+
+    EpisodeRunner::EpisodeRunner(
+        EPT_Factory factory,
+        std::shared_ptr<MCTSConfig> config,
+        int nb_simulations,
+        int nb_action_perception_cycles,
+        EvaluationType evaluation_type,
+        uint64_t seed,
+        int first_episode
+    ) : factory(std::move(factory)), config(std::move(config)), seed(seed), first_episode(first_episode) {
+        if (first_episode < 0)
+            throw std::runtime_error("In EpisodeRunner::EpisodeRunner, the first episode must not be negative.");
+
+        this->nb_simulations = nb_simulations;
+        this->nb_action_perception_cycles = nb_action_perception_cycles;
+        this->evaluation_type = evaluation_type;
+    }
+
+    void EpisodeRunner::run(
+        PerformanceTracker &perf_tracker,
+        TimeTracker &time_tracker,
+        MemoryTracker &memory_tracker,
+        const ResultSink *result_sink,
+        Checkpoint *checkpoint,
+        const StoppingRule *stopping_rule
+    ) {
+        // List the episodes left to run, the results of the episodes completed by a previous run are restored.
+        std::vector<int> pending_episodes;
+        for (int i = 0; i < nb_simulations; ++i) {
+            if (checkpoint == nullptr || !checkpoint->completed(first_episode + i))
+                pending_episodes.push_back(first_episode + i);
+        }
+        if (checkpoint != nullptr)
+            checkpoint->restore(perf_tracker, time_tracker);
+
+        // Create the environment of the episodes and the writer of the results.
+        std::shared_ptr<Environment> env = factory().first;
+        auto writer = (result_sink == nullptr) ? nullptr : result_sink->writer();
+
+        // Run the episodes one after the other, until none are left or the stopping rule is satisfied.
+        for (int episode : pending_episodes) {
+            memory_tracker.ticEpisode();
+            runEpisode(episode, env, perf_tracker, time_tracker, memory_tracker, writer.get(), checkpoint);
+            memory_tracker.tocEpisode();
+            if (stopping_rule != nullptr) {
+                PerformanceSnapshot snapshot = perf_tracker.snapshot();
+                if (stopping_rule->decide(snapshot, perf_tracker.successOutcome()) != StoppingDecision::CONTINUE)
+                    break;
+            }
+        }
+
+        // Publish the last result file, and record that all the episodes are completed.
+        writer.reset();
+        if (checkpoint != nullptr)
+            checkpoint->save();
+    }
+
+    void EpisodeRunner::runEpisode(
+        int episode,
+        std::shared_ptr<Environment> &env,
+        PerformanceTracker &perf_tracker,
+        TimeTracker &time_tracker,
+        MemoryTracker &memory_tracker,
+        ResultWriter *writer,
+        Checkpoint *checkpoint
+    ) {
+        EXPERIMENTS_PHASE("episode");
+        EXPERIMENTS_TRACE_ARG("episode", "episode", episode);
+
+        // Create the random streams of the episode. The LibTorch generator is seeded from a stream of the episode
+        // before each call made on its behalf, i.e., the environment stream for the reset, the planning stream for
+        // the creation of the agent and the action selection stream for the steps, so that the episode draws the
+        // same numbers whatever the episodes run before it, e.g., when it is replayed on its own.
+        auto streams = EpisodeStreams::create(seed, episode);
+
+        // Reset environment and create agent.
+        torch::Tensor obs;
+        {
+            EXPERIMENTS_PHASE("env->reset");
+            EXPERIMENTS_TRACE("env->reset");
+            streams->seedTorch(StreamId::ENVIRONMENT);
+            obs = env->reset();
+        }
+        std::unique_ptr<BTAI> agent;
+        {
+            EXPERIMENTS_PHASE("BTAI::create");
+            EXPERIMENTS_TRACE("BTAI::create");
+            streams->seedTorch(StreamId::PLANNING);
+            agent = BTAI::create(env.get(), config, obs);
+        }
+
+        // Run one episode, the execution time only includes the action-perception cycles.
+        LiveMetrics &live_metrics = LiveMetrics::instance();
+        EpisodeRecord record;
+        std::chrono::nanoseconds duration(0);
+        for (int k = 0; k < nb_action_perception_cycles; ++k) {
+            EXPERIMENTS_PHASE("agent->step");
+            EXPERIMENTS_TRACE_ARG("agent->step", "cycle", k);
+            streams->seedTorch(StreamId::ACTION_SELECTION);
+            auto step_start = std::chrono::steady_clock::now();
+            memory_tracker.ticStep();
+            agent->step(env, evaluation_type);
+            memory_tracker.tocStep();
+            auto step_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - step_start
+            );
+            duration += step_ns;
+            if (live_metrics.enabled())
+                live_metrics.recordStep(step_ns.count());
+            record.nb_cycles = k + 1;
+            if (env->solved())
+                break;
+        }
+        time_tracker.record((uint64_t) duration.count());
+        record.duration_ms = std::chrono::duration<double, std::milli>(duration).count();
+
+        // Clean up memory.
+        {
+            EXPERIMENTS_PHASE("FactorGraph::setCurrent");
+            agent.reset();
+            FactorGraph::setCurrent(nullptr);
+        }
+
+        // Evaluate simulation.
+        EXPERIMENTS_PHASE("perf_tracker->track");
+        perf_tracker.track(env);
+
+        // Record the episode in the checkpoint, if any.
+        if (checkpoint != nullptr)
+            checkpoint->record(episode, env, (uint64_t) duration.count());
+
+        // Write the row of the episode, with the outcome class reported by the performance tracker.
+        if (writer == nullptr)
+            return;
+        record.episode = episode;
+        record.seed = seed;
+        record.outcome = perf_tracker.snapshot().outcomes[perf_tracker.outcome(env)];
+        record.solved = env->solved();
+        writer->record(record);
+    }
+
+}
@@ -0,0 +1,139 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_EPISODE_RUNNER_H
+#define EXPERIMENTS_AI_TS_EPISODE_RUNNER_H
+
+#include <memory>
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include <algorithms/planning/EvaluationType.h>
+#include "trackers/PerformanceTracker.h"
+#include "trackers/TimeTracker.h"
+#include "trackers/MemoryTracker.h"
+#include "trackers/ResultSink.h"
+#include "trackers/StoppingRule.h"
+
+namespace hopi::environments {
+    class Environment;
+}
+
+namespace hopi::algorithms::planning {
+    class MCTSConfig;
+}
+
+namespace experiments::runners {
+
+    class Checkpoint;
+
+    // Define a type representing a pair containing an environment and a performance tracker.
+    typedef std::pair<
+        std::shared_ptr<hopi::environments::Environment>,
+        std::unique_ptr<experiments::trackers::PerformanceTracker>
+    > EPT_Pair;
+
+    // Define a type representing a function creating a fresh environment and performance tracker.
+    typedef std::function<EPT_Pair()> EPT_Factory;
+
+    class EpisodeRunner {
+    public:
+        /**
+         * Create an episode runner.
+         * @param factory the function creating the environment and performance tracker of the episodes
+         * @param config the MCTS configuration shared (read-only) by all the agents
+         * @param nb_simulations the number of episodes to run
+         * @param nb_action_perception_cycles the maximum number of action-perception cycles per episode
+         * @param evaluation_type the type of evaluation used by the agents during planning
+         * @param seed the seed of the experiment, each episode draws from streams keyed by the seed and its index
+         * @param first_episode the index of the first episode, e.g., to replay an episode on its own
+         * @return the episode runner.
+         */
+        static std::unique_ptr<EpisodeRunner> create(
+            EPT_Factory factory,
+            std::shared_ptr<hopi::algorithms::planning::MCTSConfig> config,
+            int nb_simulations,
+            int nb_action_perception_cycles,
+            hopi::algorithms::planning::EvaluationType evaluation_type,
+            uint64_t seed = 0,
+            int first_episode = 0
+        );
+
+        /**
+         * Constructor.
+         * @param factory the function creating the environment and performance tracker of the episodes
+         * @param config the MCTS configuration shared (read-only) by all the agents
+         * @param nb_simulations the number of episodes to run
+         * @param nb_action_perception_cycles the maximum number of action-perception cycles per episode
+         * @param evaluation_type the type of evaluation used by the agents during planning
+         * @param seed the seed of the experiment, each episode draws from streams keyed by the seed and its index
+         * @param first_episode the index of the first episode, e.g., to replay an episode on its own
+         */
+        EpisodeRunner(
+            EPT_Factory factory,
+            std::shared_ptr<hopi::algorithms::planning::MCTSConfig> config,
+            int nb_simulations,
+            int nb_action_perception_cycles,
+            hopi::algorithms::planning::EvaluationType evaluation_type,
+            uint64_t seed,
+            int first_episode
+        );
+
+        /**
+         * Run all the episodes on the calling thread, and record their results in the trackers passed as parameters.
+         * The episodes run one after the other, since Homing-Pigeon keeps a single current factor graph and LibTorch
+         * generator per process, the parallelism of an experiment comes from the worker processes of a sweep.
+         * @param perf_tracker the performance tracker in which the outcomes are recorded, which can be snapshot
+         * during the run
+         * @param time_tracker the time tracker in which the execution times are recorded
+         * @param memory_tracker the memory tracker in which the memory usage is recorded
+         * @param result_sink the sink in which one row per episode is written, or nullptr
+         * @param checkpoint the checkpoint in which the completed episodes are recorded, or nullptr. The episodes
+         * already completed in the checkpoint are skipped, and their results are added to the trackers
+         * @param stopping_rule the rule deciding when enough episodes have been run, or nullptr to run them all.
+         * The rule is checked after each episode, the number of simulations being the maximum number of episodes
+         */
+        void run(
+            experiments::trackers::PerformanceTracker &perf_tracker,
+            experiments::trackers::TimeTracker &time_tracker,
+            experiments::trackers::MemoryTracker &memory_tracker,
+            const experiments::trackers::ResultSink *result_sink = nullptr,
+            Checkpoint *checkpoint = nullptr,
+            const experiments::trackers::StoppingRule *stopping_rule = nullptr
+        );
+
+    private:
+        /**
+         * Run an episode.
+         * @param episode the index of the episode
+         * @param env the environment in which the episode is run
+         * @param perf_tracker the performance tracker in which the outcomes are recorded
+         * @param time_tracker the time tracker in which the execution times are recorded
+         * @param memory_tracker the memory tracker in which the memory usage is recorded
+         * @param writer the writer of the results, or nullptr
+         * @param checkpoint the checkpoint in which the completed episodes are recorded, or nullptr
+         */
+        void runEpisode(
+            int episode,
+            std::shared_ptr<hopi::environments::Environment> &env,
+            experiments::trackers::PerformanceTracker &perf_tracker,
+            experiments::trackers::TimeTracker &time_tracker,
+            experiments::trackers::MemoryTracker &memory_tracker,
+            experiments::trackers::ResultWriter *writer,
+            Checkpoint *checkpoint
+        );
+
+    private:
+        EPT_Factory factory;
+        std::shared_ptr<hopi::algorithms::planning::MCTSConfig> config;
+        int nb_simulations;
+        int nb_action_perception_cycles;
+        hopi::algorithms::planning::EvaluationType evaluation_type;
+        uint64_t seed;
+        int first_episode;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_EPISODE_RUNNER_H
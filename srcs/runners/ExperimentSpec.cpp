@@ -0,0 +1,282 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <cmath>
+#include <stdexcept>
+#include "ExperimentSpec.h"
+#include "random/RandomStream.h"
+
+using namespace hopi::environments;
+using namespace experiments::random;
+
+namespace experiments::runners {
+
+    namespace {
+
+        /**
+         * Getter.
+         * @return the parameters of an experiment, with the values of the original experiments.
+         */
+        const JsonValue::Members &defaults() {
+            static const JsonValue::Members parameters = {
+                {"env", JsonValue(std::string("graph"))},
+                {"maze_file", JsonValue(std::string("9.maze"))},
+                {"lake_file", JsonValue(std::string("5.lake"))},
+                {"nb_good_paths", JsonValue(3.0)},
+                {"nb_bad_paths", JsonValue(5.0)},
+                {"good_paths_sizes", JsonValue(std::vector<JsonValue>{JsonValue(6.0), JsonValue(5.0), JsonValue(8.0)})},
+                {"granularity", JsonValue(4.0)},
+                {"repeat", JsonValue(8.0)},
+                {"nb_simulations", JsonValue(100.0)},
+                {"nb_action_perception_cycles", JsonValue(20.0)},
+                {"nb_planning_steps", JsonValue(100.0)},
+                {"exploration_constant", JsonValue(2.0)},
+                {"precision_prior_preferences", JsonValue(3.0)},
+                {"precision_action_selection", JsonValue(100.0)},
+                {"seed", JsonValue(0.0)},
+                {"stop_width", JsonValue(0.0)},
+                {"stop_baseline", JsonValue(-1.0)},
+                {"stop_effect", JsonValue(0.1)},
+                {"stop_min_episodes", JsonValue(20.0)},
+                {"stop_confidence", JsonValue(0.95)}
+            };
+            return parameters;
+        }
+
+        /**
+         * Set the value of a parameter.
+         * @param parameters the values of all the parameters
+         * @param name the name of the parameter
+         * @param value the new value of the parameter
+         */
+        void set(JsonValue::Members &parameters, const std::string &name, const JsonValue &value) {
+            for (auto &parameter : parameters) {
+                if (parameter.first == name) {
+                    parameter.second = value;
+                    return;
+                }
+            }
+            throw std::runtime_error("In ExperimentSpec::ExperimentSpec, unknown parameter: " + name + ".");
+        }
+
+        /**
+         * Get the value of a parameter.
+         * @param parameters the values of all the parameters
+         * @param name the name of the parameter
+         * @return the value of the parameter.
+         */
+        const JsonValue &get(const JsonValue::Members &parameters, const std::string &name) {
+            for (auto &parameter : parameters) {
+                if (parameter.first == name)
+                    return parameter.second;
+            }
+            throw std::runtime_error("In ExperimentSpec::ExperimentSpec, unknown parameter: " + name + ".");
+        }
+
+        /**
+         * Get the value of an integer parameter.
+         * @param parameters the values of all the parameters
+         * @param name the name of the parameter
+         * @return the value of the parameter.
+         */
+        int integer(const JsonValue::Members &parameters, const std::string &name) {
+            return (int) get(parameters, name).integer();
+        }
+
+        /**
+         * Get the value of a real parameter.
+         * @param parameters the values of all the parameters
+         * @param name the name of the parameter
+         * @return the value of the parameter.
+         */
+        double number(const JsonValue::Members &parameters, const std::string &name) {
+            return get(parameters, name).number();
+        }
+
+    }
+
+    bool ExperimentPoint::adaptive() const {
+        return stopping.target_width > 0 || stopping.baseline > 0;
+    }
+
+    std::string ExperimentPoint::environmentKey() const {
+        std::string key = getEnvName(env_type);
+        switch (env_type) {
+            case EnvType::MAZE:
+                return key + ":" + env_options.maze_file_name;
+            case EnvType::FROZEN_LAKE:
+                return key + ":" + env_options.lake_file_name;
+            case EnvType::D_SPRITES:
+                return key + ":" + std::to_string(env_options.granularity) + ":" + std::to_string(env_options.repeat);
+            default:
+                key += ":" + std::to_string(env_options.nb_good_paths) + ":" + std::to_string(env_options.nb_bad_paths);
+                for (int size : env_options.good_paths_sizes) {
+                    key += ":" + std::to_string(size);
+                }
+                return key;
+        }
+    }
+
+    std::unique_ptr<ExperimentSpec> ExperimentSpec::load(const std::string &file_name) {
+        return create(JsonValue::parseFile(file_name));
+    }
+
+    std::unique_ptr<ExperimentSpec> ExperimentSpec::create(const JsonValue &document) {
+        return std::make_unique<ExperimentSpec>(document);
+    }
+
+    ExperimentSpec::ExperimentSpec(const JsonValue &document) {
+        for (auto &[key, value] : document.object()) {
+            if (key != "output" && key != "results" && key != "parameters" && key != "grid" && key != "random")
+                throw std::runtime_error("In ExperimentSpec::ExperimentSpec, unknown key: " + key + ".");
+        }
+        const JsonValue *output = document.find("output");
+        const JsonValue *results = document.find("results");
+        output_file = (output == nullptr) ? "../results/BTAI_spec.txt" : output->string();
+        results_dir = (results == nullptr) ? "../results/episodes" : results->string();
+
+        // Override the default parameters by the parameters of the specification.
+        JsonValue::Members base = defaults();
+        if (const JsonValue *parameters = document.find("parameters")) {
+            for (auto &[name, value] : parameters->object()) {
+                set(base, name, value);
+            }
+        }
+
+        // Collect the values of the grid, and the distributions of the random search.
+        JsonValue::Members grid;
+        if (const JsonValue *values = document.find("grid")) {
+            grid = values->object();
+            for (auto &[name, value] : grid) {
+                get(base, name);
+                if (value.array().empty())
+                    throw std::runtime_error("In ExperimentSpec::ExperimentSpec, no values for parameter: " + name);
+            }
+        }
+        int nb_samples = 1;
+        uint64_t search_seed = 0;
+        JsonValue::Members distributions;
+        if (const JsonValue *search = document.find("random")) {
+            const JsonValue *samples = search->find("samples");
+            const JsonValue *seed = search->find("seed");
+            const JsonValue *parameters = search->find("parameters");
+            if (samples == nullptr || parameters == nullptr)
+                throw std::runtime_error("In ExperimentSpec::ExperimentSpec, missing samples or parameters in random.");
+            nb_samples = (int) samples->integer();
+            search_seed = (seed == nullptr) ? 0 : (uint64_t) seed->integer();
+            distributions = parameters->object();
+            for (auto &[name, distribution] : distributions) {
+                get(base, name);
+                for (auto &[grid_name, values] : grid) {
+                    if (grid_name == name)
+                        throw std::runtime_error("In ExperimentSpec::ExperimentSpec, " + name + " is in the grid.");
+                }
+            }
+            if (nb_samples < 1)
+                throw std::runtime_error("In ExperimentSpec::ExperimentSpec, the number of samples must be positive.");
+        }
+
+        // Expand the grid, the last parameter varying the fastest, and draw the samples of each grid point.
+        std::size_t nb_grid_points = 1;
+        for (auto &[name, values] : grid) {
+            nb_grid_points *= values.array().size();
+        }
+        for (std::size_t i = 0; i < nb_grid_points; ++i) {
+            JsonValue::Members parameters = base;
+            std::size_t rest = i;
+            for (auto it = grid.rbegin(); it != grid.rend(); ++it) {
+                auto &values = it->second.array();
+                set(parameters, it->first, values[rest % values.size()]);
+                rest /= values.size();
+            }
+            for (int k = 0; k < nb_samples; ++k) {
+                int index = (int) expanded.size();
+                RandomStream stream(search_seed, index, 0);
+                for (auto &[name, distribution] : distributions) {
+                    set(parameters, name, draw(name, distribution, stream));
+                }
+                expanded.push_back(point(index, parameters));
+            }
+        }
+    }
+
+    const std::vector<ExperimentPoint> &ExperimentSpec::points() const {
+        return expanded;
+    }
+
+    const std::string &ExperimentSpec::output() const {
+        return output_file;
+    }
+
+    const std::string &ExperimentSpec::results() const {
+        return results_dir;
+    }
+
+    ExperimentPoint ExperimentSpec::point(int index, const JsonValue::Members &parameters) {
+        ExperimentPoint point;
+        point.index = index;
+        for (auto &[name, value] : parameters) {
+            point.parameters.emplace_back(name, value.str());
+        }
+
+        point.env_type = getEnvType(get(parameters, "env").string());
+        point.env_options.maze_file_name = get(parameters, "maze_file").string();
+        point.env_options.lake_file_name = get(parameters, "lake_file").string();
+        point.env_options.nb_good_paths = integer(parameters, "nb_good_paths");
+        point.env_options.nb_bad_paths = integer(parameters, "nb_bad_paths");
+        point.env_options.good_paths_sizes.clear();
+        for (auto &size : get(parameters, "good_paths_sizes").array()) {
+            point.env_options.good_paths_sizes.push_back((int) size.integer());
+        }
+        point.env_options.granularity = integer(parameters, "granularity");
+        point.env_options.repeat = integer(parameters, "repeat");
+
+        point.nb_simulations = integer(parameters, "nb_simulations");
+        point.nb_action_perception_cycles = integer(parameters, "nb_action_perception_cycles");
+        point.nb_planning_steps = integer(parameters, "nb_planning_steps");
+        point.exploration_constant = number(parameters, "exploration_constant");
+        point.precision_prior_preferences = number(parameters, "precision_prior_preferences");
+        point.precision_action_selection = number(parameters, "precision_action_selection");
+        point.seed = (uint64_t) get(parameters, "seed").integer();
+        point.stopping.target_width = number(parameters, "stop_width");
+        point.stopping.baseline = number(parameters, "stop_baseline");
+        point.stopping.effect = number(parameters, "stop_effect");
+        point.stopping.min_episodes = integer(parameters, "stop_min_episodes");
+        point.stopping.confidence = number(parameters, "stop_confidence");
+        return point;
+    }
+
+    JsonValue ExperimentSpec::draw(const std::string &name, const JsonValue &distribution, RandomStream &stream) {
+        auto &members = distribution.object();
+        if (members.size() != 1)
+            throw std::runtime_error("In ExperimentSpec::draw, expected a single distribution for " + name + ".");
+        auto &[law, arguments] = members[0];
+        auto &values = arguments.array();
+        if (law == "choice") {
+            if (values.empty())
+                throw std::runtime_error("In ExperimentSpec::draw, no values to choose from for " + name + ".");
+            return values[std::min(values.size() - 1, (std::size_t) (stream.uniform() * (double) values.size()))];
+        }
+        if (values.size() != 2)
+            throw std::runtime_error("In ExperimentSpec::draw, expected [low, high] for " + name + ".");
+        double low = values[0].number();
+        double high = values[1].number();
+        if (law == "uniform")
+            return JsonValue(low + (high - low) * stream.uniform());
+        if (law == "log_uniform") {
+            if (low <= 0 || high <= 0)
+                throw std::runtime_error("In ExperimentSpec::draw, the bounds of " + name + " must be positive.");
+            return JsonValue(std::exp(std::log(low) + (std::log(high) - std::log(low)) * stream.uniform()));
+        }
+        if (law == "int_uniform") {
+            auto first = values[0].integer();
+            auto count = values[1].integer() - first + 1;
+            if (count < 1)
+                throw std::runtime_error("In ExperimentSpec::draw, empty range for " + name + ".");
+            return JsonValue((double) (first + std::min(count - 1, (long long) (stream.uniform() * (double) count))));
+        }
+        throw std::runtime_error("In ExperimentSpec::draw, unknown distribution " + law + " for " + name + ".");
+    }
+
+}
@@ -0,0 +1,147 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_EXPERIMENT_SPEC_H
+#define EXPERIMENTS_AI_TS_EXPERIMENT_SPEC_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <environments/EnvType.h>
+#include "EnvironmentFactory.h"
+#include "trackers/StoppingRule.h"
+#include "Json.h"
+
+namespace experiments::random {
+    class RandomStream;
+}
+
+namespace experiments::runners {
+
+    // Define a point of an experiment specification, i.e., a complete configuration of the experiment.
+    struct ExperimentPoint {
+        int index;                                                     // Index of the point in the specification.
+        std::vector<std::pair<std::string, std::string>> parameters;   // Value of every parameter, as text.
+        hopi::environments::EnvType env_type;                          // Type of the environment.
+        EnvironmentOptions env_options;                                // Hyper-parameters of the environment.
+        int nb_simulations;                                            // Number of episodes.
+        int nb_action_perception_cycles;                               // Maximum number of cycles per episode.
+        int nb_planning_steps;                                         // Number of planning iterations per cycle.
+        double exploration_constant;                                   // Exploration constant of the MCTS.
+        double precision_prior_preferences;                            // Precision of the prior preferences.
+        double precision_action_selection;                             // Precision of the action selection.
+        uint64_t seed;                                                 // Seed of the random streams.
+        trackers::StoppingOptions stopping;                            // When to stop before nb_simulations.
+
+        /**
+         * Getter.
+         * @return true if the episodes should stop once the stopping rule is satisfied, false otherwise.
+         */
+        [[nodiscard]] bool adaptive() const;
+
+        /**
+         * Getter.
+         * @return a key identifying the environments of the point, points with the same key can share environments.
+         */
+        [[nodiscard]] std::string environmentKey() const;
+    };
+
+    /**
+     * Specification of an experiment, i.e., a JSON file describing the configurations to run. The parameters that
+     * are not specified take the values of the original experiments, e.g.:
+     *
+     * {
+     *   "output": "../results/BTAI_spec.txt",
+     *   "results": "../results/episodes",
+     *   "parameters": {"env": "maze", "maze_file": "9.maze", "nb_simulations": 100},
+     *   "grid": {"nb_planning_steps": [10, 50, 100], "seed": [0, 1, 2]},
+     *   "random": {
+     *     "samples": 8,
+     *     "seed": 0,
+     *     "parameters": {
+     *       "exploration_constant": {"log_uniform": [0.5, 8]},
+     *       "precision_action_selection": {"choice": [10, 100]}
+     *     }
+     *   }
+     * }
+     *
+     * The points are the cartesian product of the grid, whose first parameter varies the slowest. When random
+     * search is requested, each point of the grid is expanded into "samples" points, whose parameters are drawn
+     * from "uniform", "log_uniform", "int_uniform" or "choice" distributions. The draws come from a random stream
+     * keyed by the seed of the search and the index of the point, so the expansion is the same on every machine.
+     * When "stop_width" or "stop_baseline" is positive, "nb_simulations" is the maximum number of episodes of a
+     * point, which stops earlier once its outcome probabilities are precise enough or decided against the baseline,
+     * the intervals on the outcome probabilities having the confidence level "stop_confidence".
+     */
+    class ExperimentSpec {
+    public:
+        /**
+         * Load an experiment specification.
+         * @param file_name the name of the JSON file
+         * @return the experiment specification.
+         */
+        static std::unique_ptr<ExperimentSpec> load(const std::string &file_name);
+
+        /**
+         * Create an experiment specification.
+         * @param document the JSON document describing the experiment
+         * @return the experiment specification.
+         */
+        static std::unique_ptr<ExperimentSpec> create(const JsonValue &document);
+
+        /**
+         * Constructor.
+         * @param document the JSON document describing the experiment
+         */
+        explicit ExperimentSpec(const JsonValue &document);
+
+        /**
+         * Getter.
+         * @return the points of the experiment, in the order in which they should be run.
+         */
+        [[nodiscard]] const std::vector<ExperimentPoint> &points() const;
+
+        /**
+         * Getter.
+         * @return the name of the file in which the report of the experiment should be written.
+         */
+        [[nodiscard]] const std::string &output() const;
+
+        /**
+         * Getter.
+         * @return the directory in which one row per episode should be written.
+         */
+        [[nodiscard]] const std::string &results() const;
+
+    private:
+        /**
+         * Create a point from the values of its parameters.
+         * @param index the index of the point
+         * @param parameters the values of all the parameters
+         * @return the point.
+         */
+        static ExperimentPoint point(int index, const JsonValue::Members &parameters);
+
+        /**
+         * Draw the value of a parameter.
+         * @param name the name of the parameter
+         * @param distribution the distribution of the parameter, e.g., {"uniform": [0, 1]}
+         * @param stream the random stream from which the value is drawn
+         * @return the value.
+         */
+        static JsonValue draw(
+            const std::string &name, const JsonValue &distribution, experiments::random::RandomStream &stream
+        );
+
+    private:
+        std::string output_file;
+        std::string results_dir;
+        std::vector<ExperimentPoint> expanded;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_EXPERIMENT_SPEC_H
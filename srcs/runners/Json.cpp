@@ -0,0 +1,483 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <cmath>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "Json.h"
+
+namespace experiments::runners {
+
+    namespace {
+
+        // Define a recursive descent parser of JSON documents.
+        class JsonParser {
+        public:
+            /**
+             * Constructor.
+             * @param text the document to parse
+             */
+            explicit JsonParser(const std::string &text) : text(text), position(0) {}
+
+            /**
+             * Parse the whole document.
+             * @return the value of the document.
+             */
+            JsonValue document() {
+                JsonValue result = value();
+                skipSpaces();
+                if (position != text.size())
+                    fail("unexpected characters after the document");
+                return result;
+            }
+
+        private:
+            /**
+             * Throw an exception describing a syntax error at the current position.
+             * @param message the description of the error
+             */
+            [[noreturn]] void fail(const std::string &message) const {
+                int line = 1;
+                for (std::size_t i = 0; i < position && i < text.size(); ++i) {
+                    line += (text[i] == '\n');
+                }
+                throw std::runtime_error("In JsonValue::parse, " + message + " at line " + std::to_string(line) + ".");
+            }
+
+            /**
+             * Skip the white spaces.
+             */
+            void skipSpaces() {
+                while (position < text.size() && std::isspace((unsigned char) text[position]))
+                    ++position;
+            }
+
+            /**
+             * Consume a character, after skipping the white spaces.
+             * @param c the expected character
+             */
+            void expect(char c) {
+                skipSpaces();
+                if (position >= text.size() || text[position] != c)
+                    fail(std::string("expected '") + c + "'");
+                ++position;
+            }
+
+            /**
+             * Consume a character if it is the next one, after skipping the white spaces.
+             * @param c the character
+             * @return true if the character was consumed, false otherwise.
+             */
+            bool accept(char c) {
+                skipSpaces();
+                if (position < text.size() && text[position] == c) {
+                    ++position;
+                    return true;
+                }
+                return false;
+            }
+
+            /**
+             * Consume a keyword, i.e., true, false or null.
+             * @param keyword the keyword
+             */
+            void keyword(const std::string &keyword) {
+                if (text.compare(position, keyword.size(), keyword) != 0)
+                    fail("invalid literal");
+                position += keyword.size();
+            }
+
+            /**
+             * Parse a value.
+             * @return the value.
+             */
+            JsonValue value() {
+                skipSpaces();
+                if (position >= text.size())
+                    fail("unexpected end of document");
+                char c = text[position];
+                if (c == '{')
+                    return object();
+                if (c == '[')
+                    return array();
+                if (c == '"')
+                    return JsonValue(string());
+                if (c == 't') {
+                    keyword("true");
+                    return JsonValue(true);
+                }
+                if (c == 'f') {
+                    keyword("false");
+                    return JsonValue(false);
+                }
+                if (c == 'n') {
+                    keyword("null");
+                    return JsonValue();
+                }
+                return number();
+            }
+
+            /**
+             * Parse an object.
+             * @return the object.
+             */
+            JsonValue object() {
+                JsonValue::Members members;
+                expect('{');
+                if (accept('}'))
+                    return JsonValue(std::move(members));
+                do {
+                    skipSpaces();
+                    std::string key = string();
+                    for (auto &member : members) {
+                        if (member.first == key)
+                            fail("duplicate key \"" + key + "\"");
+                    }
+                    expect(':');
+                    members.emplace_back(key, value());
+                } while (accept(','));
+                expect('}');
+                return JsonValue(std::move(members));
+            }
+
+            /**
+             * Parse an array.
+             * @return the array.
+             */
+            JsonValue array() {
+                std::vector<JsonValue> elements;
+                expect('[');
+                if (accept(']'))
+                    return JsonValue(std::move(elements));
+                do {
+                    elements.push_back(value());
+                } while (accept(','));
+                expect(']');
+                return JsonValue(std::move(elements));
+            }
+
+            /**
+             * Parse a string, the escaped code points are encoded in UTF-8.
+             * @return the string.
+             */
+            std::string string() {
+                if (position >= text.size() || text[position] != '"')
+                    fail("expected a string");
+                std::string result;
+                for (++position; position < text.size() && text[position] != '"'; ++position) {
+                    char c = text[position];
+                    if ((unsigned char) c < 0x20)
+                        fail("unescaped control character in string");
+                    if (c != '\\') {
+                        result += c;
+                        continue;
+                    }
+                    if (++position >= text.size())
+                        break;
+                    switch (text[position]) {
+                        case '"': result += '"'; break;
+                        case '\\': result += '\\'; break;
+                        case '/': result += '/'; break;
+                        case 'b': result += '\b'; break;
+                        case 'f': result += '\f'; break;
+                        case 'n': result += '\n'; break;
+                        case 'r': result += '\r'; break;
+                        case 't': result += '\t'; break;
+                        case 'u': result += codePoint(); break;
+                        default: fail("invalid escape sequence");
+                    }
+                }
+                if (position >= text.size())
+                    fail("unterminated string");
+                ++position;
+                return result;
+            }
+
+            /**
+             * Parse the four hexadecimal digits following the current position, the position is left on the last digit.
+             * @return the value of the digits.
+             */
+            unsigned hexDigits() {
+                if (position + 4 >= text.size())
+                    fail("invalid escape sequence");
+                unsigned code = 0;
+                for (int i = 0; i < 4; ++i) {
+                    char c = text[++position];
+                    if (!std::isxdigit((unsigned char) c))
+                        fail("invalid escape sequence");
+                    code = 16 * code + (std::isdigit((unsigned char) c) ? c - '0' : std::tolower(c) - 'a' + 10);
+                }
+                return code;
+            }
+
+            /**
+             * Parse an escaped code point, the position is on the 'u' and is left on the last digit. A code point
+             * outside of the basic multilingual plane is escaped as a surrogate pair, i.e., two escape sequences.
+             * @return the code point encoded in UTF-8.
+             */
+            std::string codePoint() {
+                unsigned long code = hexDigits();
+                if (code >= 0xDC00 && code <= 0xDFFF)
+                    fail("unpaired surrogate in escape sequence");
+                if (code >= 0xD800 && code <= 0xDBFF) {
+                    if (text.compare(position + 1, 2, "\\u") != 0)
+                        fail("unpaired surrogate in escape sequence");
+                    position += 2;
+                    unsigned long low = hexDigits();
+                    if (low < 0xDC00 || low > 0xDFFF)
+                        fail("unpaired surrogate in escape sequence");
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                }
+                std::string result;
+                if (code < 0x80) {
+                    result += (char) code;
+                } else if (code < 0x800) {
+                    result += (char) (0xC0 | (code >> 6));
+                    result += (char) (0x80 | (code & 0x3F));
+                } else if (code < 0x10000) {
+                    result += (char) (0xE0 | (code >> 12));
+                    result += (char) (0x80 | ((code >> 6) & 0x3F));
+                    result += (char) (0x80 | (code & 0x3F));
+                } else {
+                    result += (char) (0xF0 | (code >> 18));
+                    result += (char) (0x80 | ((code >> 12) & 0x3F));
+                    result += (char) (0x80 | ((code >> 6) & 0x3F));
+                    result += (char) (0x80 | (code & 0x3F));
+                }
+                return result;
+            }
+
+            /**
+             * Consume the decimal digits following the current position.
+             * @return the number of digits consumed.
+             */
+            std::size_t digits() {
+                std::size_t begin = position;
+                while (position < text.size() && std::isdigit((unsigned char) text[position]))
+                    ++position;
+                return position - begin;
+            }
+
+            /**
+             * Parse a number, following the grammar of JSON, i.e., an optional minus sign, an integer part without
+             * leading zeros, an optional fraction and an optional exponent.
+             * @return the number.
+             */
+            JsonValue number() {
+                std::size_t begin = position;
+                if (position < text.size() && text[position] == '-')
+                    ++position;
+                if (position < text.size() && text[position] == '0')
+                    ++position;
+                else if (digits() == 0)
+                    fail("expected a value");
+                if (position < text.size() && text[position] == '.') {
+                    ++position;
+                    if (digits() == 0)
+                        fail("expected a digit after the decimal point");
+                }
+                if (position < text.size() && (text[position] == 'e' || text[position] == 'E')) {
+                    ++position;
+                    if (position < text.size() && (text[position] == '+' || text[position] == '-'))
+                        ++position;
+                    if (digits() == 0)
+                        fail("expected a digit in the exponent");
+                }
+                return JsonValue(std::strtod(text.substr(begin, position - begin).c_str(), nullptr));
+            }
+
+        private:
+            const std::string &text;
+            std::size_t position;
+        };
+
+        /**
+         * Get the name of a JSON type.
+         * @param type the type
+         * @return the name of the type.
+         */
+        std::string typeName(JsonValue::Type type) {
+            switch (type) {
+                case JsonValue::Type::NUL: return "null";
+                case JsonValue::Type::BOOLEAN: return "a boolean";
+                case JsonValue::Type::NUMBER: return "a number";
+                case JsonValue::Type::STRING: return "a string";
+                case JsonValue::Type::ARRAY: return "an array";
+                default: return "an object";
+            }
+        }
+
+        /**
+         * Check the type of a JSON value.
+         * @param value the value
+         * @param type the expected type
+         * @param method the name of the method, used in error messages
+         */
+        void check(const JsonValue &value, JsonValue::Type type, const std::string &method) {
+            if (value.type() != type)
+                throw std::runtime_error(
+                    "In JsonValue::" + method + ", expected " + typeName(type) + " but got " + value.str() + "."
+                );
+        }
+
+    }
+
+    JsonValue JsonValue::parse(const std::string &text) {
+        return JsonParser(text).document();
+    }
+
+    JsonValue JsonValue::parseFile(const std::string &file_name) {
+        std::ifstream file(file_name);
+        if (!file.is_open())
+            throw std::runtime_error("In JsonValue::parseFile, could not open " + file_name + ".");
+        std::ostringstream text;
+        text << file.rdbuf();
+        return parse(text.str());
+    }
+
+    JsonValue::JsonValue() : value_type(Type::NUL), boolean_value(false), number_value(0) {}
+
+    JsonValue::JsonValue(bool value) : value_type(Type::BOOLEAN), boolean_value(value), number_value(0) {}
+
+    JsonValue::JsonValue(double value) : value_type(Type::NUMBER), boolean_value(false), number_value(value) {}
+
+    JsonValue::JsonValue(std::string value)
+        : value_type(Type::STRING), boolean_value(false), number_value(0), string_value(std::move(value)) {}
+
+    JsonValue::JsonValue(std::vector<JsonValue> elements)
+        : value_type(Type::ARRAY), boolean_value(false), number_value(0), elements(std::move(elements)) {}
+
+    JsonValue::JsonValue(Members members)
+        : value_type(Type::OBJECT), boolean_value(false), number_value(0), members(std::move(members)) {}
+
+    JsonValue::Type JsonValue::type() const {
+        return value_type;
+    }
+
+    bool JsonValue::boolean() const {
+        check(*this, Type::BOOLEAN, "boolean");
+        return boolean_value;
+    }
+
+    double JsonValue::number() const {
+        check(*this, Type::NUMBER, "number");
+        return number_value;
+    }
+
+    long long JsonValue::integer() const {
+        check(*this, Type::NUMBER, "integer");
+        if (number_value != std::floor(number_value) || std::abs(number_value) > 9007199254740992.0)
+            throw std::runtime_error("In JsonValue::integer, expected an integer but got " + str() + ".");
+        return (long long) number_value;
+    }
+
+    const std::string &JsonValue::string() const {
+        check(*this, Type::STRING, "string");
+        return string_value;
+    }
+
+    const std::vector<JsonValue> &JsonValue::array() const {
+        check(*this, Type::ARRAY, "array");
+        return elements;
+    }
+
+    const JsonValue::Members &JsonValue::object() const {
+        check(*this, Type::OBJECT, "object");
+        return members;
+    }
+
+    const JsonValue *JsonValue::find(const std::string &key) const {
+        for (auto &member : object()) {
+            if (member.first == key)
+                return &member.second;
+        }
+        return nullptr;
+    }
+
+    std::string JsonValue::str() const {
+        if (value_type == Type::STRING)
+            return string_value;
+        std::string output;
+        dump(output);
+        return output;
+    }
+
+    void JsonValue::dump(std::string &output) const {
+        switch (value_type) {
+            case Type::NUL:
+                output += "null";
+                break;
+            case Type::BOOLEAN:
+                output += boolean_value ? "true" : "false";
+                break;
+            case Type::NUMBER: {
+                // Write integers without exponent, and other numbers with the fewest digits that read back exactly.
+                char buffer[32];
+                if (number_value == std::floor(number_value) && std::abs(number_value) < 1e15) {
+                    output += std::to_string((long long) number_value);
+                    break;
+                }
+                std::snprintf(buffer, sizeof(buffer), "%.17g", number_value);
+                std::string shortest = buffer;
+                for (int precision = 1; precision < 17; ++precision) {
+                    std::snprintf(buffer, sizeof(buffer), "%.*g", precision, number_value);
+                    if (std::strtod(buffer, nullptr) == number_value) {
+                        shortest = buffer;
+                        break;
+                    }
+                }
+                output += shortest;
+                break;
+            }
+            case Type::STRING:
+                output += '"';
+                for (char c : string_value) {
+                    switch (c) {
+                        case '"': output += "\\\""; break;
+                        case '\\': output += "\\\\"; break;
+                        case '\b': output += "\\b"; break;
+                        case '\f': output += "\\f"; break;
+                        case '\n': output += "\\n"; break;
+                        case '\r': output += "\\r"; break;
+                        case '\t': output += "\\t"; break;
+                        default:
+                            if ((unsigned char) c < 0x20) {
+                                char buffer[8];
+                                std::snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned) c);
+                                output += buffer;
+                            } else {
+                                output += c;
+                            }
+                    }
+                }
+                output += '"';
+                break;
+            case Type::ARRAY:
+                output += '[';
+                for (std::size_t i = 0; i < elements.size(); ++i) {
+                    if (i != 0)
+                        output += ',';
+                    elements[i].dump(output);
+                }
+                output += ']';
+                break;
+            case Type::OBJECT:
+                output += '{';
+                for (std::size_t i = 0; i < members.size(); ++i) {
+                    if (i != 0)
+                        output += ',';
+                    JsonValue(members[i].first).dump(output);
+                    output += ':';
+                    members[i].second.dump(output);
+                }
+                output += '}';
+                break;
+        }
+    }
+
+}
@@ -0,0 +1,156 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_JSON_H
+#define EXPERIMENTS_AI_TS_JSON_H
+
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace experiments::runners {
+
+    /**
+     * Value of a JSON document, e.g., an experiment specification. The members of an object are kept in the order
+     * of the document, so that the expansion of a specification does not depend on the implementation of a map.
+     */
+    class JsonValue {
+    public:
+        // Define the types of JSON values.
+        enum class Type {
+            NUL,
+            BOOLEAN,
+            NUMBER,
+            STRING,
+            ARRAY,
+            OBJECT
+        };
+
+        // Define a type representing the members of a JSON object.
+        typedef std::vector<std::pair<std::string, JsonValue>> Members;
+
+    public:
+        /**
+         * Parse a JSON document.
+         * @param text the document
+         * @return the value of the document.
+         */
+        static JsonValue parse(const std::string &text);
+
+        /**
+         * Parse a JSON file.
+         * @param file_name the name of the file
+         * @return the value of the document.
+         */
+        static JsonValue parseFile(const std::string &file_name);
+
+        /**
+         * Constructor of the null value.
+         */
+        JsonValue();
+
+        /**
+         * Constructor of a boolean value.
+         * @param value the value
+         */
+        explicit JsonValue(bool value);
+
+        /**
+         * Constructor of a number.
+         * @param value the value
+         */
+        explicit JsonValue(double value);
+
+        /**
+         * Constructor of a string.
+         * @param value the value
+         */
+        explicit JsonValue(std::string value);
+
+        /**
+         * Constructor of an array.
+         * @param elements the elements of the array
+         */
+        explicit JsonValue(std::vector<JsonValue> elements);
+
+        /**
+         * Constructor of an object.
+         * @param members the members of the object
+         */
+        explicit JsonValue(Members members);
+
+        /**
+         * Getter.
+         * @return the type of the value.
+         */
+        [[nodiscard]] Type type() const;
+
+        /**
+         * Getter.
+         * @return the boolean value, an exception is thrown if the value is not a boolean.
+         */
+        [[nodiscard]] bool boolean() const;
+
+        /**
+         * Getter.
+         * @return the number, an exception is thrown if the value is not a number.
+         */
+        [[nodiscard]] double number() const;
+
+        /**
+         * Getter.
+         * @return the number, an exception is thrown if the value is not an integer.
+         */
+        [[nodiscard]] long long integer() const;
+
+        /**
+         * Getter.
+         * @return the string, an exception is thrown if the value is not a string.
+         */
+        [[nodiscard]] const std::string &string() const;
+
+        /**
+         * Getter.
+         * @return the elements of the array, an exception is thrown if the value is not an array.
+         */
+        [[nodiscard]] const std::vector<JsonValue> &array() const;
+
+        /**
+         * Getter.
+         * @return the members of the object, an exception is thrown if the value is not an object.
+         */
+        [[nodiscard]] const Members &object() const;
+
+        /**
+         * Getter.
+         * @param key the name of the member
+         * @return the member of the object, or nullptr if the object has no such member.
+         */
+        [[nodiscard]] const JsonValue *find(const std::string &key) const;
+
+        /**
+         * Write the value in compact form.
+         * @return the JSON text of the value, strings are written without quotes at the top level.
+         */
+        [[nodiscard]] std::string str() const;
+
+    private:
+        /**
+         * Write the value in compact form.
+         * @param output the string to which the JSON text is appended
+         */
+        void dump(std::string &output) const;
+
+    private:
+        Type value_type;
+        bool boolean_value;
+        double number_value;
+        std::string string_value;
+        std::vector<JsonValue> elements;
+        Members members;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_JSON_H
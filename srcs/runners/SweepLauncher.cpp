@@ -0,0 +1,223 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <cerrno>
+#include <csignal>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <filesystem>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <torch/torch.h>
+#include "SweepLauncher.h"
+#include "EnvironmentFactory.h"
+
+using namespace hopi::environments;
+using namespace experiments::trackers;
+
+namespace experiments::runners {
+
+    std::unique_ptr<SweepLauncher> SweepLauncher::create(
+        std::vector<SweepPoint> points, int nb_processes, std::string shards_dir
+    ) {
+        return std::make_unique<SweepLauncher>(std::move(points), nb_processes, std::move(shards_dir));
+    }
+
+    std::vector<SweepPoint> SweepLauncher::grid(
+        const std::vector<EnvType> &env_types,
+        const std::vector<int> &nb_planning_steps,
+        const std::vector<double> &exploration_constants,
+        const std::vector<unsigned long> &seeds
+    ) {
+        std::vector<SweepPoint> points;
+        for (auto env_type : env_types) {
+            for (auto planning_steps : nb_planning_steps) {
+                for (auto exploration_constant : exploration_constants) {
+                    for (auto seed : seeds) {
+                        points.push_back({env_type, planning_steps, exploration_constant, seed});
+                    }
+                }
+            }
+        }
+        return points;
+    }
+
+    SweepLauncher::SweepLauncher(std::vector<SweepPoint> points, int nb_processes, std::string shards_dir)
+        : points(std::move(points)), shards_dir(shards_dir + "/" + std::to_string(getpid())) {
+        if (nb_processes < 1)
+            throw std::runtime_error("In SweepLauncher::SweepLauncher, the number of processes must be positive.");
+        this->nb_processes = nb_processes;
+    }
+
+    int SweepLauncher::run(const SweepJob &job, std::ostream &report) {
+        // Start from an empty directory, which can only be left by a crashed sweep that had the same process id.
+        std::filesystem::remove_all(shards_dir);
+        std::filesystem::create_directories(shards_dir);
+
+        // Fork the worker processes, each of them takes the index of its next point from the pipe until it is empty.
+        int tasks[2];
+        if (pipe(tasks) != 0)
+            throw std::runtime_error("In SweepLauncher::run, could not create the pipe of the sweep points.");
+        int nb_workers = std::max(1, std::min(nb_processes, (int) points.size()));
+        std::vector<pid_t> workers;
+        for (int i = 0; i < nb_workers; ++i) {
+            pid_t pid = fork();
+            if (pid == -1)
+                throw std::runtime_error("In SweepLauncher::run, could not fork worker process.");
+            if (pid == 0) {
+                // The workers already run in parallel, so the intra-op and inter-op pools of LibTorch would only
+                // oversubscribe the cores.
+                close(tasks[1]);
+                torch::set_num_threads(1);
+                torch::set_num_interop_threads(1);
+                _exit(work(tasks[0], job));
+            }
+            workers.push_back(pid);
+        }
+        close(tasks[0]);
+
+        // Send the points to the workers, the pipe being closed once all of them are sent or all the workers died.
+        auto previous_handler = signal(SIGPIPE, SIG_IGN);
+        for (int i = 0; i < points.size(); ++i) {
+            ssize_t size;
+            do {
+                size = write(tasks[1], &i, sizeof(i));
+            } while (size == -1 && errno == EINTR);
+            if (size != sizeof(i))
+                break;
+        }
+        close(tasks[1]);
+        signal(SIGPIPE, previous_handler);
+
+        // Wait for all the workers, and keep the status of those that did not exit successfully.
+        std::ostringstream crashes;
+        for (int i = 0; i < nb_workers; ++i) {
+            int status = 0;
+            while (waitpid(workers[i], &status, 0) == -1 && errno == EINTR);
+            if (WIFSIGNALED(status))
+                crashes << ", worker " << i << " killed by signal " << WTERMSIG(status);
+            else if (WEXITSTATUS(status) != EXIT_SUCCESS)
+                crashes << ", worker " << i << " exited with status " << WEXITSTATUS(status);
+        }
+
+        // Merge the shards in the order of the sweep.
+        int nb_failures = 0;
+        for (int i = 0; i < points.size(); ++i) {
+            auto &point = points[i];
+            report << "========== SWEEP POINT " << i + 1 << "/" << points.size() << " ==========" << std::endl;
+            report << "ENVIRONMENT: " << getEnvName(point.env_type) << std::endl;
+            report << "NB_PLANNING_STEPS: " << point.nb_planning_steps << std::endl;
+            report << "EXPLORATION_CONSTANT: " << point.exploration_constant << std::endl;
+            report << "SEED: " << point.seed << std::endl << std::endl;
+
+            std::ifstream shard(shardFileName(i));
+            std::ifstream error(shardFileName(i) + ".failed");
+            if (shard.is_open()) {
+                report << shard.rdbuf();
+                continue;
+            }
+            if (error.is_open()) {
+                std::ostringstream message;
+                message << error.rdbuf();
+                report << "FAILED: " << message.str() << std::endl;
+            }
+            else if (std::filesystem::exists(shardFileName(i) + ".tmp"))
+                report << "FAILED: its worker crashed" << crashes.str() << std::endl;
+            else
+                report << "FAILED: never run, all the workers crashed" << crashes.str() << std::endl;
+            report << std::endl;
+            ++nb_failures;
+        }
+
+        // Merge the performance of the points sharing the same configuration.
+        mergeConfigurations(report);
+        std::filesystem::remove_all(shards_dir);
+        return nb_failures;
+    }
+
+    int SweepLauncher::work(int tasks, const SweepJob &job) const {
+        int status = EXIT_SUCCESS;
+        int i;
+        while (true) {
+            ssize_t size;
+            do {
+                size = read(tasks, &i, sizeof(i));
+            } while (size == -1 && errno == EINTR);
+            if (size != sizeof(i))
+                break;
+
+            // Write the point result in a temporary file, which is renamed only once complete, and save the
+            // performance tracker of the point before the rename.
+            std::string file_name = shardFileName(i);
+            std::string tmp_file_name = file_name + ".tmp";
+            try {
+                std::ofstream shard(tmp_file_name);
+                if (!shard.is_open())
+                    throw std::runtime_error("could not open " + tmp_file_name);
+                auto perf_tracker = job(points[i], shard);
+                shard.close();
+                std::ofstream tracker(trackerFileName(i));
+                perf_tracker->save(tracker);
+                tracker.close();
+                if (!tracker)
+                    throw std::runtime_error("could not write " + trackerFileName(i));
+                std::filesystem::rename(tmp_file_name, file_name);
+            } catch (const std::exception &e) {
+                std::cerr << "In SweepLauncher::work, point " << i + 1 << " failed: " << e.what() << std::endl;
+                std::filesystem::remove(tmp_file_name);
+                std::filesystem::remove(trackerFileName(i));
+                std::ofstream(file_name + ".failed") << e.what();
+                status = EXIT_FAILURE;
+            }
+        }
+        close(tasks);
+        return status;
+    }
+
+    void SweepLauncher::mergeConfigurations(std::ostream &report) const {
+        std::vector<bool> merged(points.size(), false);
+        for (int i = 0; i < points.size(); ++i) {
+            if (merged[i])
+                continue;
+
+            // Add the trackers of the completed points whose configuration is the same as the i-th point.
+            auto &point = points[i];
+            auto perf_tracker = getPerfTracker(point.env_type, EnvironmentOptions());
+            std::ostringstream seeds;
+            int nb_merged = 0;
+            for (int j = i; j < points.size(); ++j) {
+                auto &other = points[j];
+                bool same = other.env_type == point.env_type && other.nb_planning_steps == point.nb_planning_steps
+                    && other.exploration_constant == point.exploration_constant;
+                if (!same)
+                    continue;
+                merged[j] = true;
+                std::ifstream tracker(trackerFileName(j));
+                if (!tracker.is_open())
+                    continue;
+                perf_tracker->load(tracker);
+                seeds << ((nb_merged == 0) ? "" : ", ") << other.seed;
+                ++nb_merged;
+            }
+
+            report << "========== SWEEP CONFIGURATION ==========" << std::endl;
+            report << "ENVIRONMENT: " << getEnvName(point.env_type) << std::endl;
+            report << "NB_PLANNING_STEPS: " << point.nb_planning_steps << std::endl;
+            report << "EXPLORATION_CONSTANT: " << point.exploration_constant << std::endl;
+            report << "SEEDS: [" << seeds.str() << "]" << std::endl << std::endl;
+            if (nb_merged != 0)
+                perf_tracker->print(report);
+        }
+    }
+
+    std::string SweepLauncher::shardFileName(int point) const {
+        return shards_dir + "/point_" + std::to_string(point) + ".txt";
+    }
+
+    std::string SweepLauncher::trackerFileName(int point) const {
+        return shards_dir + "/point_" + std::to_string(point) + ".perf";
+    }
+
+}
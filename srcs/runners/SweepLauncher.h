@@ -0,0 +1,122 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_SWEEP_LAUNCHER_H
+#define EXPERIMENTS_AI_TS_SWEEP_LAUNCHER_H
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <ostream>
+#include <functional>
+#include <environments/EnvType.h>
+#include "trackers/PerformanceTracker.h"
+
+namespace experiments::runners {
+
+    // Define a point of the hyper-parameter grid explored by a sweep.
+    struct SweepPoint {
+        hopi::environments::EnvType env_type;
+        int nb_planning_steps;
+        double exploration_constant;
+        unsigned long seed;
+    };
+
+    // Define a type representing the function running the experiment associated with a sweep point, which returns
+    // the performance tracker of the point.
+    typedef std::function<
+        std::unique_ptr<experiments::trackers::PerformanceTracker>(const SweepPoint &point, std::ostream &output)
+    > SweepJob;
+
+    class SweepLauncher {
+    public:
+        /**
+         * Create a sweep launcher.
+         * @param points the sweep points to run
+         * @param nb_processes the number of worker processes among which the points are distributed
+         * @param shards_dir the directory in which each sweep creates its own directory, named after its process
+         * id, where the workers write the result of each point
+         * @return the sweep launcher.
+         */
+        static std::unique_ptr<SweepLauncher> create(
+            std::vector<SweepPoint> points, int nb_processes, std::string shards_dir
+        );
+
+        /**
+         * Create the cartesian product of the hyper-parameter values passed as parameters.
+         * @param env_types the environment types
+         * @param nb_planning_steps the numbers of planning steps
+         * @param exploration_constants the exploration constants
+         * @param seeds the seeds
+         * @return the sweep points.
+         */
+        static std::vector<SweepPoint> grid(
+            const std::vector<hopi::environments::EnvType> &env_types,
+            const std::vector<int> &nb_planning_steps,
+            const std::vector<double> &exploration_constants,
+            const std::vector<unsigned long> &seeds
+        );
+
+        /**
+         * Constructor.
+         * @param points the sweep points to run
+         * @param nb_processes the number of worker processes among which the points are distributed
+         * @param shards_dir the directory in which each sweep creates its own directory, named after its process
+         * id, where the workers write the result of each point
+         */
+        SweepLauncher(std::vector<SweepPoint> points, int nb_processes, std::string shards_dir);
+
+        /**
+         * Fork the worker processes, wait for all of them to terminate, and merge their results into the report.
+         * The workers take the points one by one from a pipe, so the points left by a crashed worker are run by the
+         * others. The points are written in the report in the order of the sweep, and a point that failed, whose
+         * worker crashed, or that was never run because all the workers crashed, is reported as failed. The
+         * performance trackers of the points sharing the same configuration, i.e., differing only by their seed, are
+         * then merged and reported together. The calling process should not have used LibTorch before calling this
+         * function, because its thread pools do not survive a fork, and each worker limits LibTorch to a single
+         * thread.
+         * @param job the function running the experiment associated with a sweep point
+         * @param report the output stream in which the merged report should be written
+         * @return the number of points that failed.
+         */
+        int run(const SweepJob &job, std::ostream &report);
+
+    private:
+        /**
+         * Run the points read from the pipe until it is closed, this function is executed by the child process.
+         * @param tasks the read end of the pipe from which the indices of the points are read
+         * @param job the function running the experiment associated with a sweep point
+         * @return the exit status of the worker.
+         */
+        int work(int tasks, const SweepJob &job) const;
+
+        /**
+         * Merge the performance trackers of the points sharing the same configuration into the report.
+         * @param report the output stream in which the merged performance should be written
+         */
+        void mergeConfigurations(std::ostream &report) const;
+
+        /**
+         * Getter.
+         * @param point the index of the sweep point
+         * @return the name of the file in which the result of the sweep point is written.
+         */
+        [[nodiscard]] std::string shardFileName(int point) const;
+
+        /**
+         * Getter.
+         * @param point the index of the sweep point
+         * @return the name of the file in which the performance tracker of the sweep point is saved.
+         */
+        [[nodiscard]] std::string trackerFileName(int point) const;
+
+    private:
+        std::vector<SweepPoint> points;
+        int nb_processes;
+        std::string shards_dir;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_SWEEP_LAUNCHER_H
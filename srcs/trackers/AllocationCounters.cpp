@@ -0,0 +1,42 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <atomic>
+#include "AllocationCounters.h"
+
+namespace experiments::trackers {
+
+    namespace {
+        std::atomic<uint64_t> nb_allocations{0};
+        std::atomic<uint64_t> nb_bytes{0};
+        thread_local AllocationCounters counters;
+    }
+
+    AllocationCounters &AllocationCounters::local() {
+        return counters;
+    }
+
+    uint64_t AllocationCounters::totalAllocations() {
+        return nb_allocations.load(std::memory_order_relaxed);
+    }
+
+    uint64_t AllocationCounters::totalBytes() {
+        return nb_bytes.load(std::memory_order_relaxed);
+    }
+
+    void AllocationCounters::onAllocate(uint64_t requested, uint64_t usable) {
+        nb_allocations.fetch_add(1, std::memory_order_relaxed);
+        nb_bytes.fetch_add(requested, std::memory_order_relaxed);
+        counters.allocations += 1;
+        counters.bytes += requested;
+        counters.live_bytes += (int64_t) usable;
+        if (counters.live_bytes > counters.peak_live_bytes)
+            counters.peak_live_bytes = counters.live_bytes;
+    }
+
+    void AllocationCounters::onDeallocate(uint64_t usable) {
+        counters.live_bytes -= (int64_t) usable;
+    }
+
+}
@@ -0,0 +1,58 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_ALLOCATION_COUNTERS_H
+#define EXPERIMENTS_AI_TS_ALLOCATION_COUNTERS_H
+
+#include <cstdint>
+
+namespace experiments::trackers {
+
+    /**
+     * Counters of the allocations done through operator new. The counters are only updated when the allocation hook
+     * (trackers/AllocationHook.cpp) is linked in the executable, i.e., when EXPERIMENTS_TRACK_ALLOCATIONS is ON or in
+     * the benchmark executable. Otherwise, all the counters stay at zero.
+     */
+    struct AllocationCounters {
+        uint64_t allocations = 0;
+        uint64_t bytes = 0;
+        int64_t live_bytes = 0;
+        int64_t peak_live_bytes = 0;
+
+        /**
+         * Getter.
+         * @return the counters of the calling thread, the live bytes are approximate when memory is freed by another
+         * thread than the one that allocated it.
+         */
+        static AllocationCounters &local();
+
+        /**
+         * Getter.
+         * @return the number of allocations done by the process so far.
+         */
+        static uint64_t totalAllocations();
+
+        /**
+         * Getter.
+         * @return the number of bytes allocated by the process so far.
+         */
+        static uint64_t totalBytes();
+
+        /**
+         * Update the counters of the calling thread and of the process after an allocation.
+         * @param requested the number of bytes requested
+         * @param usable the number of bytes actually reserved by the allocator
+         */
+        static void onAllocate(uint64_t requested, uint64_t usable);
+
+        /**
+         * Update the counters of the calling thread after a deallocation.
+         * @param usable the number of bytes released
+         */
+        static void onDeallocate(uint64_t usable);
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_ALLOCATION_COUNTERS_H
@@ -0,0 +1,96 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <new>
+#include <cstdlib>
+#include <algorithm>
+#include <malloc.h>
+#include "AllocationCounters.h"
+
+// Replace the global operator new and delete, so that the allocations are recorded in the AllocationCounters. This
+// file is only compiled when the allocation counters are requested, because the hook costs a few atomic operations
+// per allocation.
+
+using experiments::trackers::AllocationCounters;
+
+namespace {
+
+    void *allocate(std::size_t size) {
+        void *ptr = std::malloc(size == 0 ? 1 : size);
+        if (ptr != nullptr)
+            AllocationCounters::onAllocate(size, malloc_usable_size(ptr));
+        return ptr;
+    }
+
+    void *allocate(std::size_t size, std::align_val_t alignment) {
+        void *ptr = nullptr;
+        if (posix_memalign(&ptr, std::max(sizeof(void *), static_cast<std::size_t>(alignment)), size == 0 ? 1 : size) != 0)
+            return nullptr;
+        AllocationCounters::onAllocate(size, malloc_usable_size(ptr));
+        return ptr;
+    }
+
+    void deallocate(void *ptr) {
+        if (ptr == nullptr)
+            return;
+        AllocationCounters::onDeallocate(malloc_usable_size(ptr));
+        std::free(ptr);
+    }
+
+}
+
+void *operator new(std::size_t size) {
+    void *ptr = allocate(size);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    return allocate(size);
+}
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return allocate(size);
+}
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    void *ptr = allocate(size, alignment);
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return allocate(size, alignment);
+}
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    return allocate(size, alignment);
+}
+void operator delete(void *ptr) noexcept {
+    deallocate(ptr);
+}
+void operator delete[](void *ptr) noexcept {
+    deallocate(ptr);
+}
+void operator delete(void *ptr, std::size_t) noexcept {
+    deallocate(ptr);
+}
+void operator delete[](void *ptr, std::size_t) noexcept {
+    deallocate(ptr);
+}
+void operator delete(void *ptr, std::align_val_t) noexcept {
+    deallocate(ptr);
+}
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+    deallocate(ptr);
+}
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept {
+    deallocate(ptr);
+}
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept {
+    deallocate(ptr);
+}
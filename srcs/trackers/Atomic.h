@@ -0,0 +1,24 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_ATOMIC_H
+#define EXPERIMENTS_AI_TS_ATOMIC_H
+
+#include <atomic>
+
+namespace experiments::trackers {
+
+    /**
+     * Add a value to an atomic double, std::atomic<double>::fetch_add being only available from C++20.
+     * @param target the atomic double
+     * @param value the value to add
+     */
+    inline void atomicAdd(std::atomic<double> &target, double value) {
+        double current = target.load(std::memory_order_relaxed);
+        while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed));
+    }
+
+}
+
+#endif //EXPERIMENTS_AI_TS_ATOMIC_H
@@ -18,39 +18,89 @@ namespace experiments::trackers {
 
     FrozenLakePerformanceTracker::FrozenLakePerformanceTracker(int tolerance_level) {
         tolerance = tolerance_level;
-        perf = std::vector<double>(2, 0); // Reserved space for global minimum + other
+        perf = std::vector<std::atomic<long>>(2); // Reserved space for global minimum + other
         nb_fell_in_holes = 0;
+        reset();
     }
 
     void FrozenLakePerformanceTracker::reset() {
-        for (double &i : perf)
+        for (auto &i : perf)
             i = 0;
     }
 
     void FrozenLakePerformanceTracker::track(std::shared_ptr<Environment> &environment) {
-        if (environment->type() != EnvType::FROZEN_LAKE)
-            throw std::runtime_error("In FrozenLakePerformanceTracker::track, invalid environment type.");
+        std::size_t index = outcome(environment);
         auto env = std::dynamic_pointer_cast<FrozenLakeEnv>(environment);
-        auto agent_pos = env->agentPosition();
-        auto exit_pos = env->exitPosition();
         double score = env->agentScore();
-        double md = FrozenLakeEnv::manhattan_distance(agent_pos, exit_pos);
+        double md = FrozenLakeEnv::manhattan_distance(env->agentPosition(), env->exitPosition());
 
         score -= (md == 0) ? 10 : 0;
-        nb_fell_in_holes -= (int) score;
-        if (md <= tolerance)
-            perf[1] += 1;
-        else
-            perf[0] += 1;
+        nb_fell_in_holes.fetch_sub((int) score, std::memory_order_relaxed);
+        perf[index].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::size_t FrozenLakePerformanceTracker::outcome(std::shared_ptr<Environment> &environment) const {
+        if (environment->type() != EnvType::FROZEN_LAKE)
+            throw std::runtime_error("In FrozenLakePerformanceTracker::outcome, invalid environment type.");
+        auto env = std::dynamic_pointer_cast<FrozenLakeEnv>(environment);
+        double md = FrozenLakeEnv::manhattan_distance(env->agentPosition(), env->exitPosition());
+        return (md <= tolerance) ? 1 : 0;
+    }
+
+    std::size_t FrozenLakePerformanceTracker::successOutcome() const {
+        // The global minimum is recorded last.
+        return perf.size() - 1;
     }
 
     void FrozenLakePerformanceTracker::print(std::ostream &output) const {
-        double total = std::accumulate(perf.begin(), perf.end(), 0.0);
+        auto counts = snapshot().counts;
+        double total = std::accumulate(counts.begin(), counts.end(), 0.0);
         output << "========== FROZEN LAKE PERFORMANCE TRACKER ==========" << std::endl;
-        output << "P(global): " << perf[perf.size() - 1] / total << std::endl;
-        output << "P(other): " << perf[0] / total << std::endl;
+        output << "P(global): " << counts[counts.size() - 1] / total << std::endl;
+        output << "P(other): " << counts[0] / total << std::endl;
         output << "Number of times the agent fell in a hole: " << nb_fell_in_holes << std::endl;
         output << std::endl;
     }
 
+    void FrozenLakePerformanceTracker::merge(const PerformanceTracker &other) {
+        auto tracker = dynamic_cast<const FrozenLakePerformanceTracker *>(&other);
+        if (tracker == nullptr)
+            throw std::runtime_error("In FrozenLakePerformanceTracker::merge, invalid tracker type.");
+        for (int i = 0; i < perf.size(); ++i)
+            perf[i].fetch_add(tracker->perf[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        nb_fell_in_holes.fetch_add(tracker->nb_fell_in_holes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    PerformanceSnapshot FrozenLakePerformanceTracker::snapshot() const {
+        PerformanceSnapshot snapshot;
+        snapshot.outcomes = {"other", "global"};
+        for (auto &count : perf)
+            snapshot.counts.push_back((double) count.load(std::memory_order_relaxed));
+        return snapshot;
+    }
+
+    void FrozenLakePerformanceTracker::save(std::ostream &output) const {
+        output << perf.size();
+        for (auto &count : perf)
+            output << ' ' << count.load(std::memory_order_relaxed);
+        output << ' ' << nb_fell_in_holes.load(std::memory_order_relaxed);
+    }
+
+    void FrozenLakePerformanceTracker::load(std::istream &input) {
+        std::size_t size = 0;
+        input >> size;
+        if (!input || size != perf.size())
+            throw std::runtime_error("In FrozenLakePerformanceTracker::load, invalid tracker state.");
+        std::vector<long> counts(size);
+        for (auto &count : counts)
+            input >> count;
+        int fell_in_holes = 0;
+        input >> fell_in_holes;
+        if (!input)
+            throw std::runtime_error("In FrozenLakePerformanceTracker::load, invalid tracker state.");
+        for (std::size_t i = 0; i < size; ++i)
+            perf[i].fetch_add(counts[i], std::memory_order_relaxed);
+        nb_fell_in_holes.fetch_add(fell_in_holes, std::memory_order_relaxed);
+    }
+
 }
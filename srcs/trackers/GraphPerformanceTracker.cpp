@@ -15,10 +15,10 @@ namespace experiments::trackers {
         return std::make_unique<GraphPerformanceTracker>();
     }
 
-    GraphPerformanceTracker::GraphPerformanceTracker() {
-        perf.push_back(0); // # of times the goal have been reached
-        perf.push_back(0); // # of times the simulation was still running
-        perf.push_back(0); // # of times the agent reached the bad state
+    GraphPerformanceTracker::GraphPerformanceTracker() : perf(3) {
+        perf[GOAL] = 0;          // # of times the goal have been reached
+        perf[STILL_RUNNING] = 0; // # of times the simulation was still running
+        perf[BAD_STATE] = 0;     // # of times the agent reached the bad state
     }
 
     void GraphPerformanceTracker::reset() {
@@ -28,24 +28,71 @@ namespace experiments::trackers {
     }
 
     void GraphPerformanceTracker::track(std::shared_ptr<Environment> &environment) {
+        perf[outcome(environment)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::size_t GraphPerformanceTracker::outcome(std::shared_ptr<Environment> &environment) const {
         if (environment->type() != EnvType::GRAPH)
-            throw std::runtime_error("In MazePerformanceTracker::track, invalid environment type.");
+            throw std::runtime_error("In GraphPerformanceTracker::outcome, invalid environment type.");
         auto env = std::dynamic_pointer_cast<GraphEnv>(environment);
         if (env->agentState() == 1)
-            perf[BAD_STATE] += 1;
+            return BAD_STATE;
         else if (env->agentState() == env->goalState())
-            perf[GOAL] += 1;
+            return GOAL;
         else
-            perf[STILL_RUNNING] += 1;
+            return STILL_RUNNING;
+    }
+
+    std::size_t GraphPerformanceTracker::successOutcome() const {
+        return GOAL;
     }
 
     void GraphPerformanceTracker::print(std::ostream &output) const {
-        double total = std::accumulate(perf.begin(), perf.end(), 0.0);
+        auto counts = snapshot().counts;
+        double total = std::accumulate(counts.begin(), counts.end(), 0.0);
         output << "========== MAZE PERFORMANCE TRACKER ==========" << std::endl;
-        output << "P(goal): " << perf[GOAL] / total << std::endl;
-        output << "P(still running): " << perf[STILL_RUNNING] / total << std::endl;
-        output << "P(bad state): "  << perf[BAD_STATE] / total << std::endl;
+        output << "P(goal): " << counts[GOAL] / total << std::endl;
+        output << "P(still running): " << counts[STILL_RUNNING] / total << std::endl;
+        output << "P(bad state): "  << counts[BAD_STATE] / total << std::endl;
         output << std::endl;
     }
 
+    void GraphPerformanceTracker::merge(const PerformanceTracker &other) {
+        auto tracker = dynamic_cast<const GraphPerformanceTracker *>(&other);
+        if (tracker == nullptr)
+            throw std::runtime_error("In GraphPerformanceTracker::merge, invalid tracker type.");
+        for (int i = 0; i < 3; ++i) {
+            perf[i].fetch_add(tracker->perf[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+    PerformanceSnapshot GraphPerformanceTracker::snapshot() const {
+        PerformanceSnapshot snapshot;
+        snapshot.outcomes = {"goal", "still running", "bad state"};
+        for (auto &count : perf) {
+            snapshot.counts.push_back((double) count.load(std::memory_order_relaxed));
+        }
+        return snapshot;
+    }
+
+    void GraphPerformanceTracker::save(std::ostream &output) const {
+        output << perf.size();
+        for (auto &count : perf)
+            output << ' ' << count.load(std::memory_order_relaxed);
+    }
+
+    void GraphPerformanceTracker::load(std::istream &input) {
+        std::size_t size = 0;
+        input >> size;
+        if (!input || size != perf.size())
+            throw std::runtime_error("In GraphPerformanceTracker::load, invalid tracker state.");
+        std::vector<long> counts(size);
+        for (auto &count : counts)
+            input >> count;
+        if (!input)
+            throw std::runtime_error("In GraphPerformanceTracker::load, invalid tracker state.");
+        for (std::size_t i = 0; i < size; ++i)
+            perf[i].fetch_add(counts[i], std::memory_order_relaxed);
+    }
+
 }
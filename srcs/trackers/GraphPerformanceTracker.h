@@ -6,6 +6,7 @@
 #define EXPERIMENTS_AI_TS_GRAPH_PERFORMANCE_TRACKER_H
 
 #include <vector>
+#include <atomic>
 #include <ostream>
 #include "PerformanceTracker.h"
 
@@ -41,6 +42,20 @@ namespace experiments::trackers {
          * @param env the environment whose state determine the agent performance
          */
         void track(std::shared_ptr<hopi::environments::Environment> &env) override;
+        using PerformanceTracker::track;
+
+        /**
+         * Classify the outcome of an episode based on the state of the environment, without recording it.
+         * @param env the environment whose state determine the agent performance
+         * @return the index of the outcome in the outcomes of snapshot().
+         */
+        [[nodiscard]] std::size_t outcome(std::shared_ptr<hopi::environments::Environment> &env) const override;
+
+        /**
+         * Getter.
+         * @return the index of the outcome counted as a success, e.g., by a stopping rule.
+         */
+        [[nodiscard]] std::size_t successOutcome() const override;
 
         /**
          * Display the agent performance in the output stream.
@@ -48,8 +63,32 @@ namespace experiments::trackers {
          */
         void print(std::ostream &output) const override;
 
+        /**
+         * Add the performance recorded by another tracker to the performance of this tracker.
+         * @param other the tracker whose performance should be added, must have the same type as this tracker
+         */
+        void merge(const PerformanceTracker &other) override;
+
+        /**
+         * Copy the outcome counts recorded so far, this function can be called while other threads are tracking.
+         * @return the snapshot of the outcome counts.
+         */
+        [[nodiscard]] PerformanceSnapshot snapshot() const override;
+
+        /**
+         * Write the state of the tracker, e.g., to checkpoint an experiment.
+         * @param output the stream in which the state should be written
+         */
+        void save(std::ostream &output) const override;
+
+        /**
+         * Add the state written by save() to the performance of this tracker, e.g., to resume an experiment.
+         * @param input the stream from which the state should be read
+         */
+        void load(std::istream &input) override;
+
     private:
-        std::vector<double> perf;
+        std::vector<std::atomic<long>> perf;
     };
 
 }
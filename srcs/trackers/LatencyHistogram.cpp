@@ -0,0 +1,170 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "LatencyHistogram.h"
+
+namespace experiments::trackers {
+
+    std::unique_ptr<LatencyHistogram> LatencyHistogram::create() {
+        return std::make_unique<LatencyHistogram>();
+    }
+
+    LatencyHistogram::LatencyHistogram() {
+        reset();
+    }
+
+    void LatencyHistogram::reset() {
+        for (auto &bucket : buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        nb_values.store(0, std::memory_order_relaxed);
+        sum.store(0, std::memory_order_relaxed);
+        min_value.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+        max_value.store(0, std::memory_order_relaxed);
+    }
+
+    void LatencyHistogram::record(uint64_t ns) {
+        buckets[bucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+        nb_values.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(ns, std::memory_order_relaxed);
+
+        uint64_t current = min_value.load(std::memory_order_relaxed);
+        while (ns < current && !min_value.compare_exchange_weak(current, ns, std::memory_order_relaxed));
+        current = max_value.load(std::memory_order_relaxed);
+        while (ns > current && !max_value.compare_exchange_weak(current, ns, std::memory_order_relaxed));
+    }
+
+    void LatencyHistogram::merge(const LatencyHistogram &other) {
+        for (int i = 0; i < NB_BUCKETS; ++i) {
+            uint64_t n = other.buckets[i].load(std::memory_order_relaxed);
+            if (n != 0)
+                buckets[i].fetch_add(n, std::memory_order_relaxed);
+        }
+        nb_values.fetch_add(other.nb_values.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        sum.fetch_add(other.sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        uint64_t other_min = other.min_value.load(std::memory_order_relaxed);
+        uint64_t current = min_value.load(std::memory_order_relaxed);
+        while (other_min < current && !min_value.compare_exchange_weak(current, other_min, std::memory_order_relaxed));
+        uint64_t other_max = other.max_value.load(std::memory_order_relaxed);
+        current = max_value.load(std::memory_order_relaxed);
+        while (other_max > current && !max_value.compare_exchange_weak(current, other_max, std::memory_order_relaxed));
+    }
+
+    void LatencyHistogram::save(std::ostream &output) const {
+        int nb_used = 0;
+        for (auto &bucket : buckets) {
+            nb_used += (bucket.load(std::memory_order_relaxed) != 0);
+        }
+        output << count() << ' ' << total() << ' ' << min() << ' ' << max() << ' ' << nb_used;
+        for (int i = 0; i < NB_BUCKETS; ++i) {
+            uint64_t n = buckets[i].load(std::memory_order_relaxed);
+            if (n != 0)
+                output << ' ' << i << ' ' << n;
+        }
+    }
+
+    void LatencyHistogram::load(std::istream &input) {
+        // Read the values into a temporary histogram, so that this histogram is unchanged if the input is invalid.
+        LatencyHistogram loaded;
+        uint64_t nb_loaded, sum_loaded, min_loaded, max_loaded;
+        int nb_used;
+        input >> nb_loaded >> sum_loaded >> min_loaded >> max_loaded >> nb_used;
+        for (int i = 0; input && i < nb_used; ++i) {
+            int index;
+            uint64_t n;
+            input >> index >> n;
+            if (index < 0 || index >= NB_BUCKETS)
+                throw std::runtime_error("In LatencyHistogram::load, invalid bucket index.");
+            loaded.buckets[index].store(n, std::memory_order_relaxed);
+        }
+        if (!input)
+            throw std::runtime_error("In LatencyHistogram::load, invalid histogram.");
+        loaded.nb_values.store(nb_loaded, std::memory_order_relaxed);
+        loaded.sum.store(sum_loaded, std::memory_order_relaxed);
+        if (nb_loaded != 0)
+            loaded.min_value.store(min_loaded, std::memory_order_relaxed);
+        loaded.max_value.store(max_loaded, std::memory_order_relaxed);
+        merge(loaded);
+    }
+
+    uint64_t LatencyHistogram::count() const {
+        return nb_values.load(std::memory_order_relaxed);
+    }
+
+    uint64_t LatencyHistogram::min() const {
+        return (count() == 0) ? 0 : min_value.load(std::memory_order_relaxed);
+    }
+
+    uint64_t LatencyHistogram::max() const {
+        return max_value.load(std::memory_order_relaxed);
+    }
+
+    uint64_t LatencyHistogram::total() const {
+        return sum.load(std::memory_order_relaxed);
+    }
+
+    double LatencyHistogram::mean() const {
+        uint64_t n = count();
+        return (n == 0) ? 0 : (double) total() / (double) n;
+    }
+
+    double LatencyHistogram::stddev() const {
+        uint64_t n = count();
+        if (n < 2)
+            return 0;
+        double mu = mean();
+        double squares = 0;
+        for (int i = 0; i < NB_BUCKETS; ++i) {
+            uint64_t bucket_count = buckets[i].load(std::memory_order_relaxed);
+            if (bucket_count == 0)
+                continue;
+            double value = ((double) bucketLowest(i) + (double) bucketHighest(i)) / 2.0;
+            squares += (double) bucket_count * (value - mu) * (value - mu);
+        }
+        return std::sqrt(squares / (double) (n - 1));
+    }
+
+    uint64_t LatencyHistogram::percentile(double percentile) const {
+        uint64_t n = count();
+        if (n == 0)
+            return 0;
+        auto rank = (uint64_t) std::ceil(percentile / 100.0 * (double) n);
+        rank = std::max<uint64_t>(1, std::min(rank, n));
+        uint64_t seen = 0;
+        for (int i = 0; i < NB_BUCKETS; ++i) {
+            seen += buckets[i].load(std::memory_order_relaxed);
+            if (seen >= rank)
+                return std::min(bucketHighest(i), max());
+        }
+        return max();
+    }
+
+    int LatencyHistogram::bucketIndex(uint64_t ns) {
+        if (ns < SUB_BUCKETS)
+            return (int) ns;
+        int msb = 63 - __builtin_clzll(ns);
+        int shift = msb - SUB_BUCKET_BITS;
+        return SUB_BUCKETS + shift * SUB_BUCKETS + (int) ((ns >> shift) - SUB_BUCKETS);
+    }
+
+    uint64_t LatencyHistogram::bucketLowest(int index) {
+        if (index < SUB_BUCKETS)
+            return index;
+        int shift = (index - SUB_BUCKETS) / SUB_BUCKETS;
+        uint64_t sub_bucket = (index - SUB_BUCKETS) % SUB_BUCKETS;
+        return (SUB_BUCKETS + sub_bucket) << shift;
+    }
+
+    uint64_t LatencyHistogram::bucketHighest(int index) {
+        if (index < SUB_BUCKETS)
+            return index;
+        int shift = (index - SUB_BUCKETS) / SUB_BUCKETS;
+        return bucketLowest(index) + ((uint64_t(1) << shift) - 1);
+    }
+
+}
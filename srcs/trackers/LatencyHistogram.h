@@ -0,0 +1,144 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_LATENCY_HISTOGRAM_H
+#define EXPERIMENTS_AI_TS_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+namespace experiments::trackers {
+
+    /**
+     * Fixed-memory histogram of latencies in nanoseconds. The buckets are log-linear (as in HDR histograms), i.e.,
+     * each power of two is split into SUB_BUCKETS buckets of equal width, which bounds the relative error of the
+     * reported percentiles by 1 / SUB_BUCKETS. All the counters are atomics, so values can be recorded by several
+     * threads and read during recording.
+     */
+    class LatencyHistogram {
+    public:
+        static constexpr int SUB_BUCKET_BITS = 6;
+        static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+        static constexpr int NB_BUCKETS = SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    public:
+        /**
+         * Create a latency histogram.
+         * @return the latency histogram.
+         */
+        static std::unique_ptr<LatencyHistogram> create();
+
+        /**
+         * Constructor.
+         */
+        LatencyHistogram();
+
+        /**
+         * Remove all the recorded values.
+         */
+        void reset();
+
+        /**
+         * Record a value.
+         * @param ns the value in nanoseconds
+         */
+        void record(uint64_t ns);
+
+        /**
+         * Add the values recorded by another histogram to this histogram.
+         * @param other the histogram whose values should be added
+         */
+        void merge(const LatencyHistogram &other);
+
+        /**
+         * Write the recorded values, only the non-empty buckets are written.
+         * @param output the stream in which the values should be written
+         */
+        void save(std::ostream &output) const;
+
+        /**
+         * Add the values written by save() to this histogram.
+         * @param input the stream from which the values should be read
+         */
+        void load(std::istream &input);
+
+        /**
+         * Getter.
+         * @return the number of recorded values.
+         */
+        [[nodiscard]] uint64_t count() const;
+
+        /**
+         * Getter.
+         * @return the smallest recorded value in nanoseconds, or zero if no value was recorded.
+         */
+        [[nodiscard]] uint64_t min() const;
+
+        /**
+         * Getter.
+         * @return the largest recorded value in nanoseconds.
+         */
+        [[nodiscard]] uint64_t max() const;
+
+        /**
+         * Getter.
+         * @return the sum of the recorded values in nanoseconds.
+         */
+        [[nodiscard]] uint64_t total() const;
+
+        /**
+         * Getter.
+         * @return the mean of the recorded values in nanoseconds.
+         */
+        [[nodiscard]] double mean() const;
+
+        /**
+         * Getter.
+         * @return the standard deviation of the recorded values in nanoseconds, computed from the buckets.
+         */
+        [[nodiscard]] double stddev() const;
+
+        /**
+         * Getter.
+         * @param percentile the percentile requested, e.g., 99 for the 99th percentile
+         * @return the smallest bucket value such that the requested percentage of values is lower or equal to it.
+         */
+        [[nodiscard]] uint64_t percentile(double percentile) const;
+
+        /**
+         * Getter.
+         * @param ns the value in nanoseconds
+         * @return the index of the bucket in which the value should be recorded.
+         */
+        static int bucketIndex(uint64_t ns);
+
+        /**
+         * Getter.
+         * @param index the index of the bucket
+         * @return the smallest value recorded in the bucket.
+         */
+        static uint64_t bucketLowest(int index);
+
+        /**
+         * Getter.
+         * @param index the index of the bucket
+         * @return the largest value recorded in the bucket.
+         */
+        static uint64_t bucketHighest(int index);
+
+    private:
+        std::array<std::atomic<uint64_t>, NB_BUCKETS> buckets;
+        std::atomic<uint64_t> nb_values;
+        std::atomic<uint64_t> sum;
+        std::atomic<uint64_t> min_value;
+        std::atomic<uint64_t> max_value;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_LATENCY_HISTOGRAM_H
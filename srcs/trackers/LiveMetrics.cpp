@@ -0,0 +1,113 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <utility>
+#include <numeric>
+#include <algorithm>
+#include "LiveMetrics.h"
+
+namespace experiments::trackers {
+
+    namespace {
+        /**
+         * Getter.
+         * @return the current time of the steady clock in nanoseconds.
+         */
+        int64_t nowNs() {
+            auto now = std::chrono::steady_clock::now().time_since_epoch();
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+        }
+
+        /**
+         * Escape a label value of the Prometheus text format.
+         * @param value the value
+         * @return the escaped value.
+         */
+        std::string escape(const std::string &value) {
+            std::string escaped;
+            for (char c : value) {
+                if (c == '\\' || c == '"' || c == '\n')
+                    escaped += '\\';
+                escaped += (c == '\n') ? 'n' : c;
+            }
+            return escaped;
+        }
+    }
+
+    LiveMetrics &LiveMetrics::instance() {
+        static LiveMetrics metrics;
+        return metrics;
+    }
+
+    void LiveMetrics::start(const PerformanceTracker &tracker, uint64_t restored) {
+        steps.reset();
+        start_ns.store(nowNs());
+        nb_restored.store(restored);
+        perf_tracker.store(&tracker);
+        collecting.store(true);
+    }
+
+    void LiveMetrics::stop() {
+        collecting.store(false);
+    }
+
+    bool LiveMetrics::enabled() const {
+        return collecting.load(std::memory_order_relaxed);
+    }
+
+    void LiveMetrics::recordStep(uint64_t ns) {
+        steps.record(ns);
+    }
+
+    std::string LiveMetrics::prometheus() const {
+        // Print the gauges at full precision, the counters being printed as integers.
+        std::ostringstream output;
+        output << std::setprecision(std::numeric_limits<double>::max_digits10);
+        const PerformanceTracker *tracker = perf_tracker.load();
+        int64_t start = start_ns.load();
+        double elapsed = (start == 0) ? 0 : (double) (nowNs() - start) / 1e9;
+
+        // Outcomes of the episodes completed so far.
+        if (tracker != nullptr) {
+            PerformanceSnapshot snapshot = tracker->snapshot();
+            double total = std::accumulate(snapshot.counts.begin(), snapshot.counts.end(), 0.0);
+            output << "# HELP btai_episodes_total Episodes completed, by outcome class." << '\n';
+            output << "# TYPE btai_episodes_total counter" << '\n';
+            for (std::size_t i = 0; i < snapshot.outcomes.size(); ++i) {
+                output << "btai_episodes_total{outcome=\"" << escape(snapshot.outcomes[i]) << "\"} "
+                       << (uint64_t) snapshot.counts[i] << '\n';
+            }
+            output << "# HELP btai_outcome_rate Fraction of the completed episodes, by outcome class." << '\n';
+            output << "# TYPE btai_outcome_rate gauge" << '\n';
+            for (std::size_t i = 0; i < snapshot.outcomes.size(); ++i) {
+                output << "btai_outcome_rate{outcome=\"" << escape(snapshot.outcomes[i]) << "\"} "
+                       << ((total == 0) ? 0 : snapshot.counts[i] / total) << '\n';
+            }
+            // The episodes restored from a checkpoint were not completed since the start, and are not in the rate.
+            double completed = std::max(0.0, total - (double) nb_restored.load());
+            output << "# HELP btai_episodes_per_second Episodes completed per second since the start." << '\n';
+            output << "# TYPE btai_episodes_per_second gauge" << '\n';
+            output << "btai_episodes_per_second " << ((elapsed == 0) ? 0 : completed / elapsed) << '\n';
+        }
+
+        // Latency of the action-perception cycles.
+        output << "# HELP btai_step_latency_seconds Duration of the action-perception cycles." << '\n';
+        output << "# TYPE btai_step_latency_seconds summary" << '\n';
+        const std::pair<const char *, double> quantiles[] = {{"0.5", 50}, {"0.9", 90}, {"0.99", 99}, {"0.999", 99.9}};
+        for (const auto &[label, percentile] : quantiles) {
+            output << "btai_step_latency_seconds{quantile=\"" << label << "\"} "
+                   << (double) steps.percentile(percentile) / 1e9 << '\n';
+        }
+        output << "btai_step_latency_seconds_sum " << (double) steps.total() / 1e9 << '\n';
+        output << "btai_step_latency_seconds_count " << steps.count() << '\n';
+        output << "# HELP btai_uptime_seconds Time elapsed since the metrics were started." << '\n';
+        output << "# TYPE btai_uptime_seconds gauge" << '\n';
+        output << "btai_uptime_seconds " << elapsed << '\n';
+        return output.str();
+    }
+
+}
@@ -0,0 +1,71 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_LIVE_METRICS_H
+#define EXPERIMENTS_AI_TS_LIVE_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include "LatencyHistogram.h"
+#include "PerformanceTracker.h"
+
+namespace experiments::trackers {
+
+    /**
+     * Running metrics of the experiment, which can be read while the episodes are running. The outcome counts are
+     * read from the performance tracker, whose snapshot is lock-free, and the step latencies are recorded in an
+     * atomic histogram. When the metrics are not started, recording a step costs a single atomic load.
+     */
+    class LiveMetrics {
+    public:
+        /**
+         * Getter.
+         * @return the live metrics of the process.
+         */
+        static LiveMetrics &instance();
+
+        /**
+         * Start collecting the metrics of an experiment.
+         * @param perf_tracker the performance tracker in which the outcomes of the episodes are recorded
+         * @param nb_restored the number of episodes restored from a checkpoint, which are counted in the outcomes
+         * but not in the rate of the episodes completed since the start
+         */
+        void start(const PerformanceTracker &perf_tracker, uint64_t nb_restored = 0);
+
+        /**
+         * Stop collecting the metrics, the last values can still be read.
+         */
+        void stop();
+
+        /**
+         * Getter.
+         * @return true if the metrics are being collected, false otherwise.
+         */
+        [[nodiscard]] bool enabled() const;
+
+        /**
+         * Record the duration of an action-perception cycle.
+         * @param ns the duration in nanoseconds
+         */
+        void recordStep(uint64_t ns);
+
+        /**
+         * Format the current value of the metrics.
+         * @return the metrics in the Prometheus text exposition format.
+         */
+        [[nodiscard]] std::string prometheus() const;
+
+    private:
+        std::atomic<bool> collecting{false};
+        std::atomic<const PerformanceTracker *> perf_tracker{nullptr};
+        std::atomic<int64_t> start_ns{0};
+        std::atomic<uint64_t> nb_restored{0};
+        LatencyHistogram steps;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_LIVE_METRICS_H
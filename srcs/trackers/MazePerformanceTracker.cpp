@@ -21,18 +21,23 @@ namespace experiments::trackers {
     MazePerformanceTracker::MazePerformanceTracker(const std::vector<std::pair<int, int>> &local_minimums_pos, int tolerance_level) {
         local_pos = local_minimums_pos;
         tolerance = tolerance_level;
-        perf = std::vector<double>(local_minimums_pos.size() + 2, 0); // Reserved space for # local minimums + global minimum + other
+        perf = std::vector<std::atomic<long>>(local_minimums_pos.size() + 2); // Reserved space for # local minimums + global minimum + other
+        reset();
     }
 
     void MazePerformanceTracker::reset() {
-        for (double &i : perf) {
+        for (auto &i : perf) {
             i = 0;
         }
     }
 
     void MazePerformanceTracker::track(std::shared_ptr<Environment> &environment) {
+        perf[outcome(environment)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::size_t MazePerformanceTracker::outcome(std::shared_ptr<Environment> &environment) const {
         if (environment->type() != EnvType::MAZE)
-            throw std::runtime_error("In MazePerformanceTracker::track, invalid environment type.");
+            throw std::runtime_error("In MazePerformanceTracker::outcome, invalid environment type.");
         auto env = std::dynamic_pointer_cast<MazeEnv>(environment);
         auto agent_pos = env->agentPosition();
         auto exit_pos = env->exitPosition();
@@ -44,23 +49,71 @@ namespace experiments::trackers {
             }
         }
         if (MazeEnv::manhattan_distance(agent_pos, exit_pos) <= tolerance) {
-            perf[perf.size() - 1] += 1;
+            return perf.size() - 1;
         } else if (local_min != - 1) {
-            perf[local_min + 1] += 1;
+            return local_min + 1;
         } else {
-            perf[0] += 1;
+            return 0;
         }
     }
 
+    std::size_t MazePerformanceTracker::successOutcome() const {
+        // The global minimum is recorded last.
+        return perf.size() - 1;
+    }
+
     void MazePerformanceTracker::print(std::ostream &output) const {
-        double total = std::accumulate(perf.begin(), perf.end(), 0.0);
+        auto counts = snapshot().counts;
+        double total = std::accumulate(counts.begin(), counts.end(), 0.0);
         output << "========== MAZE PERFORMANCE TRACKER ==========" << std::endl;
-        output << "P(global): " << perf[perf.size() - 1] / total << std::endl;
+        output << "P(global): " << counts[counts.size() - 1] / total << std::endl;
         for (int i = 0; i < local_pos.size(); ++i) {
-            output << "P(local " + std::to_string(i + 1) + "): "  << perf[i + 1] / total << std::endl;
+            output << "P(local " + std::to_string(i + 1) + "): "  << counts[i + 1] / total << std::endl;
         }
-        output << "P(other): " << perf[0] / total << std::endl;
+        output << "P(other): " << counts[0] / total << std::endl;
         output << std::endl;
     }
 
+    void MazePerformanceTracker::merge(const PerformanceTracker &other) {
+        auto tracker = dynamic_cast<const MazePerformanceTracker *>(&other);
+        if (tracker == nullptr || tracker->perf.size() != perf.size())
+            throw std::runtime_error("In MazePerformanceTracker::merge, invalid tracker type.");
+        for (int i = 0; i < perf.size(); ++i) {
+            perf[i].fetch_add(tracker->perf[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+
+    PerformanceSnapshot MazePerformanceTracker::snapshot() const {
+        PerformanceSnapshot snapshot;
+        snapshot.outcomes.emplace_back("other");
+        for (int i = 0; i < local_pos.size(); ++i) {
+            snapshot.outcomes.emplace_back("local " + std::to_string(i + 1));
+        }
+        snapshot.outcomes.emplace_back("global");
+        for (auto &count : perf) {
+            snapshot.counts.push_back((double) count.load(std::memory_order_relaxed));
+        }
+        return snapshot;
+    }
+
+    void MazePerformanceTracker::save(std::ostream &output) const {
+        output << perf.size();
+        for (auto &count : perf)
+            output << ' ' << count.load(std::memory_order_relaxed);
+    }
+
+    void MazePerformanceTracker::load(std::istream &input) {
+        std::size_t size = 0;
+        input >> size;
+        if (!input || size != perf.size())
+            throw std::runtime_error("In MazePerformanceTracker::load, invalid tracker state.");
+        std::vector<long> counts(size);
+        for (auto &count : counts)
+            input >> count;
+        if (!input)
+            throw std::runtime_error("In MazePerformanceTracker::load, invalid tracker state.");
+        for (std::size_t i = 0; i < size; ++i)
+            perf[i].fetch_add(counts[i], std::memory_order_relaxed);
+    }
+
 }
@@ -0,0 +1,96 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <algorithm>
+#include <malloc.h>
+#include <sys/resource.h>
+#include "MemoryTracker.h"
+
+namespace experiments::trackers {
+
+    MemoryUsage::MemoryUsage(std::string name) : name(std::move(name)) {}
+
+    void MemoryUsage::tic() {
+        // The peak of the enclosing section is saved, so that nested sections can be measured on the same thread.
+        auto &counters = AllocationCounters::local();
+        begin = counters;
+        enclosing_peak = counters.peak_live_bytes;
+        counters.peak_live_bytes = counters.live_bytes;
+    }
+
+    void MemoryUsage::toc() {
+        auto &counters = AllocationCounters::local();
+        allocations.record(counters.allocations - begin.allocations);
+        bytes.record(counters.bytes - begin.bytes);
+        peak_bytes.record(std::max<int64_t>(0, counters.peak_live_bytes - begin.live_bytes));
+        heap_bytes.record(MemoryTracker::heapInUse());
+        counters.peak_live_bytes = std::max(enclosing_peak, counters.peak_live_bytes);
+    }
+
+    void MemoryUsage::print(std::ostream &output) const {
+        constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+        output << "Number of " << name << " runs: " << allocations.count() << std::endl;
+        if (allocations.count() == 0)
+            return;
+        output << "Allocations per " << name << ": " << allocations.mean() << " +/- " << allocations.stddev()
+               << " (p99 = " << allocations.percentile(99) << ", max = " << allocations.max() << ")" << std::endl;
+        output << "MB allocated per " << name << ": " << bytes.mean() / BYTES_PER_MB
+               << " (p99 = " << (double) bytes.percentile(99) / BYTES_PER_MB
+               << ", max = " << (double) bytes.max() / BYTES_PER_MB << ")" << std::endl;
+        output << "Peak live MB per " << name << ": " << peak_bytes.mean() / BYTES_PER_MB
+               << " (p99 = " << (double) peak_bytes.percentile(99) / BYTES_PER_MB
+               << ", max = " << (double) peak_bytes.max() / BYTES_PER_MB << ")" << std::endl;
+        output << "Heap in use in MB after each " << name << ": "
+               << "p50 = " << (double) heap_bytes.percentile(50) / BYTES_PER_MB << ", "
+               << "max = " << (double) heap_bytes.max() / BYTES_PER_MB << std::endl;
+    }
+
+    std::unique_ptr<MemoryTracker> MemoryTracker::create() {
+        return std::make_unique<MemoryTracker>();
+    }
+
+    MemoryTracker::MemoryTracker() : episodes("episode"), steps("agent->step") {}
+
+    void MemoryTracker::ticEpisode() {
+        episodes.tic();
+    }
+
+    void MemoryTracker::tocEpisode() {
+        episodes.toc();
+    }
+
+    void MemoryTracker::ticStep() {
+        steps.tic();
+    }
+
+    void MemoryTracker::tocStep() {
+        steps.toc();
+    }
+
+    void MemoryTracker::print(std::ostream &output) const {
+        output << "========== MEMORY TRACKER ==========" << std::endl;
+        if (AllocationCounters::totalAllocations() == 0)
+            output << "Allocation counters disabled, configure with -DEXPERIMENTS_TRACK_ALLOCATIONS=ON." << std::endl;
+        episodes.print(output);
+        steps.print(output);
+        output << "Peak resident set size in MB: " << (double) peakRss() / 1024.0 << std::endl;
+        output << std::endl;
+    }
+
+    uint64_t MemoryTracker::heapInUse() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        struct mallinfo2 info = mallinfo2();
+        return info.uordblks + info.hblkhd;
+#else
+        return 0;
+#endif
+    }
+
+    long MemoryTracker::peakRss() {
+        struct rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+}
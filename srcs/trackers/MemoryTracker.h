@@ -0,0 +1,109 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_MEMORY_TRACKER_H
+#define EXPERIMENTS_AI_TS_MEMORY_TRACKER_H
+
+#include <memory>
+#include <string>
+#include <ostream>
+#include "LatencyHistogram.h"
+#include "AllocationCounters.h"
+
+namespace experiments::trackers {
+
+    // Define the memory statistics recorded for one kind of section (e.g., episodes or action-perception cycles).
+    struct MemoryUsage {
+        std::string name;
+        LatencyHistogram allocations;
+        LatencyHistogram bytes;
+        LatencyHistogram peak_bytes;
+        LatencyHistogram heap_bytes;
+        AllocationCounters begin;
+        int64_t enclosing_peak = 0;
+
+        /**
+         * Constructor.
+         * @param name the name of the section
+         */
+        explicit MemoryUsage(std::string name);
+
+        /**
+         * Start measuring the section on the calling thread.
+         */
+        void tic();
+
+        /**
+         * Stop measuring the section on the calling thread, and record its statistics.
+         */
+        void toc();
+
+        /**
+         * Display the statistics of the section.
+         * @param output the output stream in which the display must be done.
+         */
+        void print(std::ostream &output) const;
+    };
+
+    class MemoryTracker {
+    public:
+        /**
+         * Create a memory tracker.
+         * @return the memory tracker.
+         */
+        static std::unique_ptr<MemoryTracker> create();
+
+        /**
+         * Constructor.
+         */
+        MemoryTracker();
+
+        /**
+         * Start measuring an episode on the calling thread.
+         */
+        void ticEpisode();
+
+        /**
+         * Stop measuring the episode.
+         */
+        void tocEpisode();
+
+        /**
+         * Start measuring an action-perception cycle (i.e., agent->step) on the calling thread.
+         */
+        void ticStep();
+
+        /**
+         * Stop measuring the action-perception cycle.
+         */
+        void tocStep();
+
+        /**
+         * Display the number of allocations, the bytes allocated and the peak live bytes of the episodes and
+         * action-perception cycles, as well as the heap usage and peak resident set size of the process.
+         * @param output the output stream in which the display must be done.
+         */
+        void print(std::ostream &output) const;
+
+        /**
+         * Getter.
+         * @return the number of bytes currently allocated by malloc, which includes the storage of the LibTorch
+         * tensors, or zero if the C library cannot report it.
+         */
+        static uint64_t heapInUse();
+
+        /**
+         * Getter.
+         * @return the peak resident set size of the process in kilobytes.
+         */
+        static long peakRss();
+
+    private:
+        MemoryUsage episodes;
+        MemoryUsage steps;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_MEMORY_TRACKER_H
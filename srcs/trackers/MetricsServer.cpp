@@ -0,0 +1,123 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <cstring>
+#include <stdexcept>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "MetricsServer.h"
+
+namespace experiments::trackers {
+
+    namespace {
+        // The time after which the server checks whether it should stop, in milliseconds.
+        const int POLL_TIMEOUT_MS = 200;
+
+        // The time after which a client that does not send its request is dropped, in milliseconds.
+        const int CLIENT_TIMEOUT_MS = 1000;
+    }
+
+    std::unique_ptr<MetricsServer> MetricsServer::create(const std::string &address, const LiveMetrics &metrics) {
+        return std::make_unique<MetricsServer>(address, metrics);
+    }
+
+    MetricsServer::MetricsServer(const std::string &address, const LiveMetrics &metrics)
+        : metrics(metrics), fd(-1), running(true) {
+        bool is_port = !address.empty() && address.find_first_not_of("0123456789") == std::string::npos;
+        int status;
+        if (is_port) {
+            int port = address.size() <= 5 ? std::stoi(address) : 0;
+            if (port < 1 || port > 65535)
+                throw std::runtime_error("In MetricsServer::MetricsServer, " + address + " is not a valid port.");
+
+            // Listen on the loopback interface only, the metrics are not meant to be exposed to the network.
+            fd = socket(AF_INET, SOCK_STREAM, 0);
+            int reuse = 1;
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+            sockaddr_in local{};
+            local.sin_family = AF_INET;
+            local.sin_port = htons((uint16_t) port);
+            local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            status = bind(fd, (sockaddr *) &local, sizeof(local));
+        } else {
+            sockaddr_un local{};
+            if (address.size() >= sizeof(local.sun_path))
+                throw std::runtime_error("In MetricsServer::MetricsServer, the socket path is too long.");
+
+            // Only replace the socket left by a previous run, never a file that happens to have the same path.
+            struct stat existing{};
+            if (lstat(address.c_str(), &existing) == 0) {
+                if (!S_ISSOCK(existing.st_mode))
+                    throw std::runtime_error("In MetricsServer::MetricsServer, " + address + " is not a socket.");
+                unlink(address.c_str());
+            }
+            fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            local.sun_family = AF_UNIX;
+            std::strncpy(local.sun_path, address.c_str(), sizeof(local.sun_path) - 1);
+            socket_path = address;
+            status = bind(fd, (sockaddr *) &local, sizeof(local));
+        }
+        if (fd < 0 || status != 0 || listen(fd, 16) != 0) {
+            if (fd >= 0)
+                close(fd);
+            throw std::runtime_error("In MetricsServer::MetricsServer, could not listen on " + address + ".");
+        }
+        server = std::thread(&MetricsServer::serve, this);
+    }
+
+    MetricsServer::~MetricsServer() {
+        running = false;
+        server.join();
+        close(fd);
+        if (!socket_path.empty())
+            unlink(socket_path.c_str());
+    }
+
+    void MetricsServer::serve() {
+        pollfd listener{fd, POLLIN, 0};
+        while (running) {
+            if (poll(&listener, 1, POLL_TIMEOUT_MS) <= 0)
+                continue;
+            int client = accept(fd, nullptr, nullptr);
+            if (client < 0)
+                continue;
+            answer(client);
+            close(client);
+        }
+    }
+
+    void MetricsServer::answer(int client) const {
+        // Read the request until the end of its headers, the request itself is ignored.
+        std::string request;
+        char buffer[1024];
+        pollfd input{client, POLLIN, 0};
+        while (request.find("\r\n\r\n") == std::string::npos && request.size() < 8192) {
+            if (poll(&input, 1, CLIENT_TIMEOUT_MS) <= 0)
+                return;
+            ssize_t n = recv(client, buffer, sizeof(buffer), 0);
+            if (n <= 0)
+                return;
+            request.append(buffer, n);
+        }
+
+        // Answer with the current metrics.
+        std::string body = metrics.prometheus();
+        std::string response = "HTTP/1.0 200 OK\r\n"
+                               "Content-Type: text/plain; version=0.0.4\r\n"
+                               "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                               "Connection: close\r\n\r\n" + body;
+        for (std::size_t sent = 0; sent < response.size();) {
+            ssize_t n = send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0)
+                return;
+            sent += n;
+        }
+    }
+
+}
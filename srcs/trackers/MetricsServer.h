@@ -0,0 +1,68 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_METRICS_SERVER_H
+#define EXPERIMENTS_AI_TS_METRICS_SERVER_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include "LiveMetrics.h"
+
+namespace experiments::trackers {
+
+    /**
+     * Minimal HTTP server publishing the live metrics in the Prometheus text format, on a local TCP port or on a
+     * Unix socket. Each request is answered with the current metrics, whatever its path, by a single background
+     * thread, e.g., curl localhost:<port>/metrics or curl --unix-socket <path> http://localhost/metrics.
+     */
+    class MetricsServer {
+    public:
+        /**
+         * Create a metrics server.
+         * @param address a port number, to listen on 127.0.0.1, or the path of a Unix socket
+         * @param metrics the metrics to publish
+         * @return the metrics server.
+         */
+        static std::unique_ptr<MetricsServer> create(const std::string &address, const LiveMetrics &metrics);
+
+        /**
+         * Constructor, start listening.
+         * @param address a port number, to listen on 127.0.0.1, or the path of a Unix socket
+         * @param metrics the metrics to publish
+         */
+        MetricsServer(const std::string &address, const LiveMetrics &metrics);
+
+        /**
+         * Destructor, stop listening.
+         */
+        ~MetricsServer();
+
+        MetricsServer(const MetricsServer &) = delete;
+        MetricsServer &operator=(const MetricsServer &) = delete;
+
+    private:
+        /**
+         * Answer the requests until the server is destroyed.
+         */
+        void serve();
+
+        /**
+         * Answer a request.
+         * @param client the socket of the client
+         */
+        void answer(int client) const;
+
+    private:
+        const LiveMetrics &metrics;
+        std::string socket_path;
+        int fd;
+        std::atomic<bool> running;
+        std::thread server;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_METRICS_SERVER_H
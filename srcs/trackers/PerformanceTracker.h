@@ -6,6 +6,10 @@
 #define EXPERIMENTS_AI_TS_PERFORMANCE_TRACKER_H
 
 #include <memory>
+#include <vector>
+#include <string>
+#include <ostream>
+#include <istream>
 
 namespace hopi::environments {
     class Environment;
@@ -13,6 +17,12 @@ namespace hopi::environments {
 
 namespace experiments::trackers {
 
+    // Define a copy of the outcome counts recorded by a performance tracker at a given point in time.
+    struct PerformanceSnapshot {
+        std::vector<std::string> outcomes;
+        std::vector<double> counts;
+    };
+
     class PerformanceTracker {
     public:
         /**
@@ -21,16 +31,59 @@ namespace experiments::trackers {
         virtual void reset() = 0;
 
         /**
-         * Update the performance based on the state of the environment.
+         * Update the performance based on the state of the environment, this function can be called concurrently
+         * by several threads.
          * @param env the environment whose state determine the agent performance
          */
         virtual void track(std::shared_ptr<hopi::environments::Environment> &env) = 0;
 
+        /**
+         * Classify the outcome of an episode based on the state of the environment, without recording it.
+         * @param env the environment whose state determine the agent performance
+         * @return the index of the outcome in the outcomes of snapshot().
+         */
+        [[nodiscard]] virtual std::size_t outcome(std::shared_ptr<hopi::environments::Environment> &env) const = 0;
+
+        /**
+         * Getter.
+         * @return the index of the outcome counted as a success, e.g., by a stopping rule.
+         */
+        [[nodiscard]] virtual std::size_t successOutcome() const = 0;
+
         /**
          * Display the agent performance in the output stream.
          * @param output the stream in which the performance should be written
          */
         virtual void print(std::ostream &output) const = 0;
+
+        /**
+         * Add the performance recorded by another tracker to the performance of this tracker.
+         * @param other the tracker whose performance should be added, must have the same type as this tracker
+         */
+        virtual void merge(const PerformanceTracker &other) = 0;
+
+        /**
+         * Copy the outcome counts recorded so far, this function can be called while other threads are tracking.
+         * @return the snapshot of the outcome counts.
+         */
+        [[nodiscard]] virtual PerformanceSnapshot snapshot() const = 0;
+
+        /**
+         * Write the state of the tracker, e.g., to checkpoint an experiment.
+         * @param output the stream in which the state should be written
+         */
+        virtual void save(std::ostream &output) const = 0;
+
+        /**
+         * Add the state written by save() to the performance of this tracker, e.g., to resume an experiment.
+         * @param input the stream from which the state should be read
+         */
+        virtual void load(std::istream &input) = 0;
+
+        /**
+         * Virtual destructor.
+         */
+        virtual ~PerformanceTracker() = default;
     };
 
 }
@@ -0,0 +1,126 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <cstring>
+#include <string>
+#include "PhaseTracker.h"
+
+namespace experiments::trackers {
+
+    namespace {
+
+        // Define the aggregation of the phases with the same path over all the threads.
+        struct MergedPhase {
+            std::string name;
+            std::unique_ptr<LatencyHistogram> latencies = LatencyHistogram::create();
+            std::vector<std::unique_ptr<MergedPhase>> children;
+        };
+
+        void mergePhase(MergedPhase &merged, const PhaseNode &node) {
+            merged.latencies->merge(node.latencies);
+            for (auto &child : node.children) {
+                MergedPhase *target = nullptr;
+                for (auto &merged_child : merged.children) {
+                    if (merged_child->name == child->name)
+                        target = merged_child.get();
+                }
+                if (target == nullptr) {
+                    merged.children.push_back(std::make_unique<MergedPhase>());
+                    target = merged.children.back().get();
+                    target->name = child->name;
+                }
+                mergePhase(*target, *child);
+            }
+        }
+
+        void printPhase(std::ostream &output, const MergedPhase &phase, int depth, double parent_total) {
+            constexpr double NS_PER_MS = 1e6;
+            auto &latencies = *phase.latencies;
+            output << std::string(2 * depth, ' ') << phase.name << ": "
+                   << "calls = " << latencies.count() << ", "
+                   << "total = " << (double) latencies.total() / NS_PER_MS << " ms";
+            if (parent_total > 0)
+                output << " (" << 100.0 * (double) latencies.total() / parent_total << "% of parent)";
+            output << ", mean = " << latencies.mean() / NS_PER_MS << " ms"
+                   << ", p50 = " << (double) latencies.percentile(50) / NS_PER_MS << " ms"
+                   << ", p99 = " << (double) latencies.percentile(99) / NS_PER_MS << " ms"
+                   << ", max = " << (double) latencies.max() / NS_PER_MS << " ms" << std::endl;
+            for (auto &child : phase.children) {
+                printPhase(output, *child, depth + 1, (double) latencies.total());
+            }
+        }
+
+    }
+
+    PhaseNode::PhaseNode(const char *name, PhaseNode *parent) : name(name), parent(parent) {}
+
+    PhaseNode *PhaseNode::child(const char *child_name) {
+        for (auto &node : children) {
+            if (node->name == child_name || std::strcmp(node->name, child_name) == 0)
+                return node.get();
+        }
+        children.push_back(std::make_unique<PhaseNode>(child_name, this));
+        return children.back().get();
+    }
+
+    PhaseTracker &PhaseTracker::instance() {
+        static PhaseTracker tracker;
+        return tracker;
+    }
+
+    PhaseNode *&PhaseTracker::current() {
+        static thread_local PhaseNode *node = nullptr;
+        if (node == nullptr) {
+            std::lock_guard<std::mutex> lock(mutex);
+            roots.push_back(std::make_unique<PhaseNode>("", nullptr));
+            node = roots.back().get();
+        }
+        return node;
+    }
+
+    void PhaseTracker::reset() {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<PhaseNode *> nodes;
+        for (auto &root : roots) {
+            nodes.push_back(root.get());
+        }
+        while (!nodes.empty()) {
+            PhaseNode *node = nodes.back();
+            nodes.pop_back();
+            node->latencies.reset();
+            for (auto &child : node->children) {
+                nodes.push_back(child.get());
+            }
+        }
+    }
+
+    void PhaseTracker::print(std::ostream &output) {
+        std::lock_guard<std::mutex> lock(mutex);
+        MergedPhase merged;
+        for (auto &root : roots) {
+            mergePhase(merged, *root);
+        }
+        if (merged.children.empty())
+            return;
+        output << "========== PHASE TRACKER ==========" << std::endl;
+        for (auto &phase : merged.children) {
+            printPhase(output, *phase, 0, 0);
+        }
+        output << std::endl;
+    }
+
+    ScopedPhase::ScopedPhase(const char *name) {
+        PhaseNode *&current = PhaseTracker::instance().current();
+        node = current->child(name);
+        current = node;
+        begin = std::chrono::steady_clock::now();
+    }
+
+    ScopedPhase::~ScopedPhase() {
+        auto end = std::chrono::steady_clock::now();
+        node->latencies.record(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+        PhaseTracker::instance().current() = node->parent;
+    }
+
+}
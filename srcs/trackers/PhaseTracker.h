@@ -0,0 +1,107 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_PHASE_TRACKER_H
+#define EXPERIMENTS_AI_TS_PHASE_TRACKER_H
+
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <ostream>
+#include "LatencyHistogram.h"
+
+/**
+ * The macro EXPERIMENTS_PHASE(name) times the enclosing scope as a phase called name (a string literal). Phases
+ * opened while another phase is active are recorded as children of the active phase. The macro expands to nothing
+ * unless EXPERIMENTS_ENABLE_PHASES is defined, i.e., the timing zones cost nothing in normal builds.
+ */
+#define EXPERIMENTS_PHASE_CONCAT_IMPL(x, y) x##y
+#define EXPERIMENTS_PHASE_CONCAT(x, y) EXPERIMENTS_PHASE_CONCAT_IMPL(x, y)
+#ifdef EXPERIMENTS_ENABLE_PHASES
+#define EXPERIMENTS_PHASE(name) \
+    experiments::trackers::ScopedPhase EXPERIMENTS_PHASE_CONCAT(experiments_phase_, __LINE__)(name)
+#else
+#define EXPERIMENTS_PHASE(name) ((void) 0)
+#endif
+
+namespace experiments::trackers {
+
+    // Define a node of the tree of phases recorded by a thread.
+    struct PhaseNode {
+        const char *name;
+        PhaseNode *parent;
+        LatencyHistogram latencies;
+        std::vector<std::unique_ptr<PhaseNode>> children;
+
+        /**
+         * Constructor.
+         * @param name the name of the phase
+         * @param parent the enclosing phase
+         */
+        PhaseNode(const char *name, PhaseNode *parent);
+
+        /**
+         * Getter.
+         * @param name the name of the child phase
+         * @return the child phase with the given name, which is created if it does not exist.
+         */
+        PhaseNode *child(const char *name);
+    };
+
+    class PhaseTracker {
+    public:
+        /**
+         * Getter.
+         * @return the phase tracker of the process.
+         */
+        static PhaseTracker &instance();
+
+        /**
+         * Getter.
+         * @return a reference to the active phase of the calling thread.
+         */
+        PhaseNode *&current();
+
+        /**
+         * Remove all the recorded latencies, the phases must not be active.
+         */
+        void reset();
+
+        /**
+         * Display the total time and latency distribution of each phase, aggregated over all the threads.
+         * Nothing is displayed if no phase has been recorded.
+         * @param output the output stream in which the display must be done.
+         */
+        void print(std::ostream &output);
+
+    private:
+        std::mutex mutex;
+        std::vector<std::unique_ptr<PhaseNode>> roots;
+    };
+
+    class ScopedPhase {
+    public:
+        /**
+         * Start timing a phase.
+         * @param name the name of the phase, must outlive the phase tracker (e.g., a string literal)
+         */
+        explicit ScopedPhase(const char *name);
+
+        /**
+         * Stop timing the phase.
+         */
+        ~ScopedPhase();
+
+        ScopedPhase(const ScopedPhase &) = delete;
+        ScopedPhase &operator=(const ScopedPhase &) = delete;
+
+    private:
+        PhaseNode *node;
+        std::chrono::time_point<std::chrono::steady_clock> begin;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_PHASE_TRACKER_H
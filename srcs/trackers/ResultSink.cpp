@@ -0,0 +1,134 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <ctime>
+#include <atomic>
+#include <cstdio>
+#include <sstream>
+#include <limits>
+#include <iomanip>
+#include <stdexcept>
+#include <filesystem>
+#include <unistd.h>
+#include "ResultSink.h"
+
+namespace experiments::trackers {
+
+    namespace {
+        // The size of the stream buffer of a result file, the rows are written by large blocks.
+        const std::size_t BUFFER_SIZE = 1 << 20;
+
+        // The columns of EpisodeRecord.
+        const char *RECORD_COLUMNS = "episode,seed,outcome,solved,nb_cycles,duration_ms";
+
+        // The number of sinks created by the process, e.g., one per point of a specification.
+        std::atomic<int> nb_sinks{0};
+    }
+
+    ResultWriter::ResultWriter(const ResultSink &sink)
+        : sink(sink), nb_files(0), nb_rows(0), buffer(BUFFER_SIZE) {
+        file.rdbuf()->pubsetbuf(buffer.data(), (std::streamsize) buffer.size());
+        open();
+    }
+
+    ResultWriter::~ResultWriter() {
+        try {
+            rotate();
+        } catch (const std::exception &) {
+            // The results of the current file are lost, but the destructor must not throw.
+        }
+    }
+
+    void ResultWriter::record(const EpisodeRecord &record) {
+        if (!file.is_open())
+            open();
+        file << sink.prefix() << record.episode << ',' << record.seed << ',' << ResultSink::field(record.outcome)
+             << ',' << record.solved << ',' << record.nb_cycles << ',' << record.duration_ms << '\n';
+        if (++nb_rows >= sink.rowsPerFile())
+            rotate();
+    }
+
+    void ResultWriter::rotate() {
+        if (!file.is_open())
+            return;
+        file.close();
+        if (!file)
+            throw std::runtime_error("In ResultWriter::rotate, could not write " + file_name + ".");
+        std::string tmp_file_name = file_name + ".tmp";
+        if (nb_rows == 0)
+            std::remove(tmp_file_name.c_str());
+        else if (std::rename(tmp_file_name.c_str(), file_name.c_str()) != 0)
+            throw std::runtime_error("In ResultWriter::rotate, could not rename " + tmp_file_name + ".");
+        nb_rows = 0;
+    }
+
+    void ResultWriter::open() {
+        file_name = sink.fileName(nb_files++);
+        file.clear();
+        file.open(file_name + ".tmp", std::ios::trunc);
+        if (!file.is_open())
+            throw std::runtime_error("In ResultWriter::open, could not open " + file_name + ".tmp.");
+        file << std::setprecision(std::numeric_limits<double>::max_digits10) << sink.header() << '\n';
+    }
+
+    std::unique_ptr<ResultSink> ResultSink::create(
+        const std::string &directory, const Configuration &configuration, std::size_t rows_per_file
+    ) {
+        return std::make_unique<ResultSink>(directory, configuration, rows_per_file);
+    }
+
+    ResultSink::ResultSink(const std::string &directory, const Configuration &configuration, std::size_t rows_per_file)
+        : directory(directory), rows_per_file(rows_per_file) {
+        if (rows_per_file == 0)
+            throw std::runtime_error("In ResultSink::ResultSink, the number of rows per file must be positive.");
+        std::filesystem::create_directories(directory);
+
+        // Name the run after its start time, process and sink, so that concurrent runs and the sinks created by a
+        // process within the same second never write the same files.
+        std::time_t now = std::time(nullptr);
+        std::ostringstream name;
+        name << std::put_time(std::localtime(&now), "%Y%m%d-%H%M%S") << "-" << getpid() << "-" << nb_sinks++;
+        run = name.str();
+
+        // Format the header row, and the configuration columns of every row.
+        for (auto &[column, value] : configuration) {
+            header_row += field(column) + ",";
+            row_prefix += field(value) + ",";
+        }
+        header_row += RECORD_COLUMNS;
+    }
+
+    std::unique_ptr<ResultWriter> ResultSink::writer() const {
+        return std::make_unique<ResultWriter>(*this);
+    }
+
+    const std::string &ResultSink::header() const {
+        return header_row;
+    }
+
+    const std::string &ResultSink::prefix() const {
+        return row_prefix;
+    }
+
+    std::string ResultSink::fileName(int part) const {
+        std::ostringstream name;
+        name << directory << "/" << run << "-" << std::setw(4) << std::setfill('0') << part << ".csv";
+        return name.str();
+    }
+
+    std::size_t ResultSink::rowsPerFile() const {
+        return rows_per_file;
+    }
+
+    std::string ResultSink::field(const std::string &value) {
+        if (value.find_first_of(",\"\n") == std::string::npos)
+            return value;
+        std::string quoted = "\"";
+        for (char c : value) {
+            quoted += (c == '"') ? "\"\"" : std::string(1, c);
+        }
+        return quoted + "\"";
+    }
+
+}
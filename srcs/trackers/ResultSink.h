@@ -0,0 +1,153 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_RESULT_SINK_H
+#define EXPERIMENTS_AI_TS_RESULT_SINK_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+#include <utility>
+
+namespace experiments::trackers {
+
+    // Define the result of an episode, i.e., a row of the result files.
+    struct EpisodeRecord {
+        int episode = 0;          // Index of the episode.
+        uint64_t seed = 0;        // Seed of the experiment.
+        std::string outcome;      // Outcome class, as reported by the performance tracker.
+        bool solved = false;      // Whether the environment was solved.
+        int nb_cycles = 0;        // Number of action-perception cycles performed.
+        double duration_ms = 0;   // Execution time of the episode.
+    };
+
+    class ResultSink;
+
+    /**
+     * Writer of the results of a run. The rows are buffered and written by large blocks. A file is written under a
+     * temporary name, and renamed once it is complete, i.e., when it reaches the number of rows per file or when
+     * the writer is destroyed. Readers therefore only see complete files, even while the experiment is running.
+     */
+    class ResultWriter {
+    public:
+        /**
+         * Constructor.
+         * @param sink the sink whose configuration and naming scheme is used
+         */
+        explicit ResultWriter(const ResultSink &sink);
+
+        /**
+         * Destructor, publish the current file.
+         */
+        ~ResultWriter();
+
+        ResultWriter(const ResultWriter &) = delete;
+        ResultWriter &operator=(const ResultWriter &) = delete;
+
+        /**
+         * Record the result of an episode.
+         * @param record the result of the episode
+         */
+        void record(const EpisodeRecord &record);
+
+        /**
+         * Publish the current file, the next records go to a new file.
+         */
+        void rotate();
+
+    private:
+        /**
+         * Open a new file, and write the header row.
+         */
+        void open();
+
+    private:
+        const ResultSink &sink;
+        int nb_files;
+        std::size_t nb_rows;
+        std::string file_name;
+        std::ofstream file;
+        std::vector<char> buffer;
+    };
+
+    /**
+     * Sink of the per-episode results of an experiment, written as CSV files with one row per episode. Each row
+     * starts with the configuration of the experiment, followed by the columns of EpisodeRecord. The files of a
+     * run are named <directory>/<run>-<part>.csv, and can be scanned together, e.g., by pandas or DuckDB.
+     */
+    class ResultSink {
+    public:
+        // Define a type representing the configuration of an experiment, i.e., pairs of column name and value.
+        typedef std::vector<std::pair<std::string, std::string>> Configuration;
+
+        /**
+         * Create a result sink.
+         * @param directory the directory in which the result files are written
+         * @param configuration the configuration of the experiment, repeated on each row
+         * @param rows_per_file the number of rows after which a file is published and a new file is started
+         * @return the result sink.
+         */
+        static std::unique_ptr<ResultSink> create(
+            const std::string &directory, const Configuration &configuration, std::size_t rows_per_file = 1 << 16
+        );
+
+        /**
+         * Constructor.
+         * @param directory the directory in which the result files are written
+         * @param configuration the configuration of the experiment, repeated on each row
+         * @param rows_per_file the number of rows after which a file is published and a new file is started
+         */
+        ResultSink(const std::string &directory, const Configuration &configuration, std::size_t rows_per_file);
+
+        /**
+         * Create the writer of the run.
+         * @return the writer.
+         */
+        [[nodiscard]] std::unique_ptr<ResultWriter> writer() const;
+
+        /**
+         * Getter.
+         * @return the header row of the result files.
+         */
+        [[nodiscard]] const std::string &header() const;
+
+        /**
+         * Getter.
+         * @return the configuration columns, already formatted as the beginning of a row.
+         */
+        [[nodiscard]] const std::string &prefix() const;
+
+        /**
+         * Getter.
+         * @param part the index of the file among the files of the run
+         * @return the name of the file.
+         */
+        [[nodiscard]] std::string fileName(int part) const;
+
+        /**
+         * Getter.
+         * @return the number of rows after which a file is published.
+         */
+        [[nodiscard]] std::size_t rowsPerFile() const;
+
+        /**
+         * Format a value as a CSV field, quoting it if needed.
+         * @param value the value
+         * @return the field.
+         */
+        static std::string field(const std::string &value);
+
+    private:
+        std::string directory;
+        std::string run;
+        std::string header_row;
+        std::string row_prefix;
+        std::size_t rows_per_file;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_RESULT_SINK_H
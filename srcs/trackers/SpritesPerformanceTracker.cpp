@@ -3,10 +3,12 @@
 //
 
 #include <tuple>
+#include <algorithm>
 #include <environments/EnvType.h>
 #include "SpritesPerformanceTracker.h"
 #include "environments/Environment.h"
 #include "environments/DisentangleSpritesEnv.h"
+#include "Atomic.h"
 
 using namespace hopi::environments;
 
@@ -18,11 +20,13 @@ namespace experiments::trackers {
 
     SpritesPerformanceTracker::SpritesPerformanceTracker() {
         nb_runs = 0;
+        nb_solved = 0;
         total_perf = 0;
     }
 
     void SpritesPerformanceTracker::reset() {
         nb_runs = 0;
+        nb_solved = 0;
         total_perf = 0;
     }
 
@@ -31,15 +35,68 @@ namespace experiments::trackers {
             throw std::runtime_error("In SpritesPerformanceTracker::track, invalid environment type.");
         auto env = std::dynamic_pointer_cast<DisentangleSpritesEnv>(environment);
 
-        total_perf += env->reward_obtained();
-        nb_runs += 1;
+        nb_runs.fetch_add(1, std::memory_order_relaxed);
+        if (outcome(environment) == successOutcome())
+            nb_solved.fetch_add(1, std::memory_order_relaxed);
+        atomicAdd(total_perf, env->reward_obtained());
+    }
+
+    std::size_t SpritesPerformanceTracker::outcome(std::shared_ptr<Environment> &environment) const {
+        if (environment->type() != EnvType::D_SPRITES)
+            throw std::runtime_error("In SpritesPerformanceTracker::outcome, invalid environment type.");
+        auto env = std::dynamic_pointer_cast<DisentangleSpritesEnv>(environment);
+
+        // The reward obtained is +1 when the task is solved and -1 otherwise.
+        return (env->reward_obtained() > 0) ? 0 : 1;
+    }
+
+    std::size_t SpritesPerformanceTracker::successOutcome() const {
+        return 0;
     }
 
     void SpritesPerformanceTracker::print(std::ostream &output) const {
+        auto counts = snapshot().counts;
+        double runs = counts[0] + counts[1];
         output << "========== D-SPRITES PERFORMANCE TRACKER ==========" << std::endl;
-        double percentage = (total_perf + nb_runs) / (2.0 * nb_runs);
-        output << "Solved percentage: " << percentage << std::endl;
+        output << "Solved percentage: " << counts[0] / runs << std::endl;
+        output << "Average reward: " << total_perf.load(std::memory_order_relaxed) / runs << std::endl;
         output << std::endl;
     }
 
+    void SpritesPerformanceTracker::merge(const PerformanceTracker &other) {
+        auto tracker = dynamic_cast<const SpritesPerformanceTracker *>(&other);
+        if (tracker == nullptr)
+            throw std::runtime_error("In SpritesPerformanceTracker::merge, invalid tracker type.");
+        nb_runs.fetch_add(tracker->nb_runs.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        nb_solved.fetch_add(tracker->nb_solved.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        atomicAdd(total_perf, tracker->total_perf.load(std::memory_order_relaxed));
+    }
+
+    PerformanceSnapshot SpritesPerformanceTracker::snapshot() const {
+        // The counters are read one after the other while other threads may be tracking.
+        double solved = nb_solved.load(std::memory_order_relaxed);
+        double runs = std::max(solved, (double) nb_runs.load(std::memory_order_relaxed));
+        PerformanceSnapshot snapshot;
+        snapshot.outcomes = {"solved", "failed"};
+        snapshot.counts = {solved, runs - solved};
+        return snapshot;
+    }
+
+    void SpritesPerformanceTracker::save(std::ostream &output) const {
+        output << nb_runs.load(std::memory_order_relaxed) << ' ' << nb_solved.load(std::memory_order_relaxed) << ' '
+               << total_perf.load(std::memory_order_relaxed);
+    }
+
+    void SpritesPerformanceTracker::load(std::istream &input) {
+        int runs = 0;
+        int solved = 0;
+        double perf = 0;
+        input >> runs >> solved >> perf;
+        if (!input || solved < 0 || solved > runs)
+            throw std::runtime_error("In SpritesPerformanceTracker::load, invalid tracker state.");
+        nb_runs.fetch_add(runs, std::memory_order_relaxed);
+        nb_solved.fetch_add(solved, std::memory_order_relaxed);
+        atomicAdd(total_perf, perf);
+    }
+
 }
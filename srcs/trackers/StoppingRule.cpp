@@ -0,0 +1,112 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+#include "StoppingRule.h"
+
+namespace experiments::trackers {
+
+    std::unique_ptr<StoppingRule> StoppingRule::create(const StoppingOptions &options) {
+        return std::make_unique<StoppingRule>(options);
+    }
+
+    StoppingRule::StoppingRule(const StoppingOptions &options) : options(options) {
+        if (options.confidence <= 0 || options.confidence >= 1)
+            throw std::runtime_error("In StoppingRule::StoppingRule, the confidence level must be in (0, 1).");
+        if (options.baseline > 0 && options.baseline >= 1)
+            throw std::runtime_error("In StoppingRule::StoppingRule, the baseline must be in (0, 1).");
+        if (options.baseline > 0 && (options.alpha <= 0 || options.beta <= 0 || options.effect <= 0))
+            throw std::runtime_error("In StoppingRule::StoppingRule, alpha, beta and effect must be positive.");
+        z = normalQuantile(options.confidence);
+    }
+
+    StoppingDecision StoppingRule::decide(const PerformanceSnapshot &snapshot, std::size_t success) const {
+        double trials = std::accumulate(snapshot.counts.begin(), snapshot.counts.end(), 0.0);
+        if (trials < options.min_episodes || trials == 0)
+            return StoppingDecision::CONTINUE;
+
+        // Decide the success probability against the baseline, the thresholds are Wald's approximations.
+        if (options.baseline > 0) {
+            double p0 = std::max(1e-6, options.baseline - options.effect);
+            double p1 = std::min(1 - 1e-6, options.baseline + options.effect);
+            double ratio = logLikelihoodRatio(snapshot.counts[success], trials, p0, p1);
+            if (ratio >= std::log((1 - options.beta) / options.alpha))
+                return StoppingDecision::BETTER;
+            if (ratio <= std::log(options.beta / (1 - options.alpha)))
+                return StoppingDecision::WORSE;
+        }
+
+        // Check the width of the interval of every outcome probability.
+        if (options.target_width > 0) {
+            double width = 0;
+            for (double count : snapshot.counts) {
+                auto [lower, upper] = wilson(count, trials, z);
+                width = std::max(width, upper - lower);
+            }
+            if (width <= options.target_width)
+                return StoppingDecision::PRECISE;
+        }
+        return StoppingDecision::CONTINUE;
+    }
+
+    void StoppingRule::print(std::ostream &output, const PerformanceSnapshot &snapshot, std::size_t success) const {
+        double trials = std::accumulate(snapshot.counts.begin(), snapshot.counts.end(), 0.0);
+        output << "========== STOPPING RULE ==========" << std::endl;
+        output << "Decision: " << name(decide(snapshot, success)) << " after " << trials << " episodes" << std::endl;
+        for (std::size_t i = 0; i < snapshot.counts.size(); ++i) {
+            auto [lower, upper] = wilson(snapshot.counts[i], trials, z);
+            output << "P(" << snapshot.outcomes[i] << ") in [" << lower << ", " << upper << "] with confidence "
+                   << options.confidence << std::endl;
+        }
+        if (options.baseline > 0) {
+            double p0 = std::max(1e-6, options.baseline - options.effect);
+            double p1 = std::min(1 - 1e-6, options.baseline + options.effect);
+            output << "Log-likelihood ratio of P(" << snapshot.outcomes[success] << ") = " << p1 << " against "
+                   << p0 << ": " << logLikelihoodRatio(snapshot.counts[success], trials, p0, p1) << std::endl;
+        }
+        output << std::endl;
+    }
+
+    std::pair<double, double> StoppingRule::wilson(double successes, double trials, double z) {
+        if (trials <= 0)
+            return {0, 1};
+        double p = successes / trials;
+        double z2 = z * z;
+        double center = (p + z2 / (2 * trials)) / (1 + z2 / trials);
+        double half_width = z * std::sqrt(p * (1 - p) / trials + z2 / (4 * trials * trials)) / (1 + z2 / trials);
+        return {std::max(0.0, center - half_width), std::min(1.0, center + half_width)};
+    }
+
+    double StoppingRule::normalQuantile(double confidence) {
+        // Solve erfc(z / sqrt(2)) = 1 - confidence by bisection, erfc being decreasing.
+        double low = 0;
+        double high = 40;
+        for (int i = 0; i < 100; ++i) {
+            double middle = (low + high) / 2;
+            if (std::erfc(middle / std::sqrt(2.0)) > 1 - confidence)
+                low = middle;
+            else
+                high = middle;
+        }
+        return (low + high) / 2;
+    }
+
+    double StoppingRule::logLikelihoodRatio(double successes, double trials, double p0, double p1) {
+        double failures = trials - successes;
+        return successes * std::log(p1 / p0) + failures * std::log((1 - p1) / (1 - p0));
+    }
+
+    std::string StoppingRule::name(StoppingDecision decision) {
+        switch (decision) {
+            case StoppingDecision::PRECISE: return "precise";
+            case StoppingDecision::BETTER: return "better than baseline";
+            case StoppingDecision::WORSE: return "worse than baseline";
+            default: return "continue";
+        }
+    }
+
+}
@@ -0,0 +1,112 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_STOPPING_RULE_H
+#define EXPERIMENTS_AI_TS_STOPPING_RULE_H
+
+#include <memory>
+#include <string>
+#include <ostream>
+#include <utility>
+#include "PerformanceTracker.h"
+
+namespace experiments::trackers {
+
+    // Define the options of a stopping rule, a criterion is disabled when its parameter is not positive.
+    struct StoppingOptions {
+        int min_episodes = 20;     // Number of episodes run before any decision.
+        double confidence = 0.95;  // Confidence level of the intervals on the outcome probabilities.
+        double target_width = 0;   // Stop when the interval of every outcome probability is narrower than this.
+        double baseline = -1;      // Stop when the success probability is decided to be above or below this.
+        double effect = 0.1;       // Smallest difference from the baseline that the sequential test should detect.
+        double alpha = 0.05;       // Probability of deciding "better" when P(success) is baseline - effect.
+        double beta = 0.05;        // Probability of deciding "worse" when P(success) is baseline + effect.
+    };
+
+    // Define the decisions of a stopping rule.
+    enum class StoppingDecision {
+        CONTINUE,  // More episodes are needed.
+        PRECISE,   // The outcome probabilities are known with the requested precision.
+        BETTER,    // The success probability is above the baseline.
+        WORSE      // The success probability is below the baseline.
+    };
+
+    /**
+     * Rule deciding when a configuration has run enough episodes, based on the outcome counts of a performance
+     * tracker. The rule stops either when the Wilson score intervals of all the outcome probabilities reach the
+     * target width, or when Wald's sequential probability ratio test decides whether the success probability is
+     * above or below a baseline, i.e., H0: p = baseline - effect against H1: p = baseline + effect.
+     */
+    class StoppingRule {
+    public:
+        /**
+         * Create a stopping rule.
+         * @param options the options of the rule
+         * @return the stopping rule.
+         */
+        static std::unique_ptr<StoppingRule> create(const StoppingOptions &options);
+
+        /**
+         * Constructor.
+         * @param options the options of the rule
+         */
+        explicit StoppingRule(const StoppingOptions &options);
+
+        /**
+         * Decide whether more episodes are needed.
+         * @param snapshot the outcome counts recorded so far
+         * @param success the index of the outcome counted as a success
+         * @return the decision.
+         */
+        [[nodiscard]] StoppingDecision decide(const PerformanceSnapshot &snapshot, std::size_t success) const;
+
+        /**
+         * Display the decision and the confidence intervals of the outcome probabilities in the output stream.
+         * @param output the stream in which the decision should be written
+         * @param snapshot the outcome counts recorded so far
+         * @param success the index of the outcome counted as a success
+         */
+        void print(std::ostream &output, const PerformanceSnapshot &snapshot, std::size_t success) const;
+
+        /**
+         * Compute the Wilson score interval of a probability.
+         * @param successes the number of successes
+         * @param trials the number of trials
+         * @param z the quantile of the standard normal distribution, e.g., 1.96 for a 95% interval
+         * @return the lower and upper bounds of the interval.
+         */
+        static std::pair<double, double> wilson(double successes, double trials, double z);
+
+        /**
+         * Compute the quantile of the standard normal distribution associated with a two-sided confidence level.
+         * @param confidence the confidence level, e.g., 0.95
+         * @return the quantile, e.g., 1.96.
+         */
+        static double normalQuantile(double confidence);
+
+        /**
+         * Compute the log-likelihood ratio of the sequential probability ratio test.
+         * @param successes the number of successes
+         * @param trials the number of trials
+         * @param p0 the success probability under H0
+         * @param p1 the success probability under H1
+         * @return the log-likelihood ratio of H1 against H0.
+         */
+        static double logLikelihoodRatio(double successes, double trials, double p0, double p1);
+
+        /**
+         * Getter.
+         * @param decision the decision
+         * @return the name of the decision.
+         */
+        static std::string name(StoppingDecision decision);
+
+    private:
+        StoppingOptions options;
+        double z;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_STOPPING_RULE_H
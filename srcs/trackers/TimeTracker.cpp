@@ -2,40 +2,58 @@
 // Created by Theophile Champion on 01/07/2021.
 //
 
-#include <chrono>
 #include "TimeTracker.h"
-#include "api/API.h"
-
-using namespace hopi::api;
 
 namespace experiments::trackers {
 
-    std::unique_ptr<TimeTracker> TimeTracker::create(int nb_runs) {
-        return std::make_unique<TimeTracker>(nb_runs);
+    std::unique_ptr<TimeTracker> TimeTracker::create() {
+        return std::make_unique<TimeTracker>();
     }
 
-    TimeTracker::TimeTracker(int nb_runs) {
-        ex_times_s = API::zeros({nb_runs});
-        ex_times_ms = API::zeros({nb_runs});
-        index = 0;
-    }
+    TimeTracker::TimeTracker() = default;
 
     void TimeTracker::tic() {
         begin = std::chrono::steady_clock::now();
     }
 
     void TimeTracker::toc() {
-        end = std::chrono::steady_clock::now();
-        ex_times_s[index] = std::chrono::duration_cast<std::chrono::seconds>(end - begin).count();
-        ex_times_ms[index] = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count();
-        index++;
+        auto end = std::chrono::steady_clock::now();
+        ex_times.record(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    }
+
+    void TimeTracker::record(uint64_t ns) {
+        ex_times.record(ns);
     }
 
     void TimeTracker::print(std::ostream &output) const {
+        constexpr double NS_PER_S = 1e9;
+        constexpr double NS_PER_MS = 1e6;
         output << "========== TIME TRACKER ==========" << std::endl;
-        output << "Time in second: " << ex_times_s.mean().item<double>() << " +/- " << ex_times_s.std().item<double>() << std::endl;
-        output << "Time in millisecond: " << ex_times_ms.mean().item<double>() << " +/- " << ex_times_ms.std().item<double>() << std::endl;
+        output << "Number of runs: " << ex_times.count() << std::endl;
+        output << "Time in second: " << ex_times.mean() / NS_PER_S << " +/- " << ex_times.stddev() / NS_PER_S << std::endl;
+        output << "Time in millisecond: " << ex_times.mean() / NS_PER_MS << " +/- " << ex_times.stddev() / NS_PER_MS << std::endl;
+        output << "Percentiles in millisecond: "
+               << "p50 = " << (double) ex_times.percentile(50) / NS_PER_MS << ", "
+               << "p90 = " << (double) ex_times.percentile(90) / NS_PER_MS << ", "
+               << "p99 = " << (double) ex_times.percentile(99) / NS_PER_MS << ", "
+               << "max = " << (double) ex_times.max() / NS_PER_MS << std::endl;
         output << std::endl;
     }
 
-}
\ No newline at end of file
+    void TimeTracker::merge(const TimeTracker &other) {
+        ex_times.merge(other.ex_times);
+    }
+
+    void TimeTracker::save(std::ostream &output) const {
+        ex_times.save(output);
+    }
+
+    void TimeTracker::load(std::istream &input) {
+        ex_times.load(input);
+    }
+
+    const LatencyHistogram &TimeTracker::histogram() const {
+        return ex_times;
+    }
+
+}
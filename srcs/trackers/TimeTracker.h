@@ -7,7 +7,8 @@
 
 #include <iostream>
 #include <memory>
-#include <torch/torch.h>
+#include <chrono>
+#include "LatencyHistogram.h"
 
 namespace experiments::trackers {
 
@@ -15,16 +16,14 @@ namespace experiments::trackers {
     public:
         /**
          * Create a time tracker.
-         * @param nb_runs the number of runs whose time should be tracked.
          * @return the time tracker.
          */
-        static std::unique_ptr<TimeTracker> create(int nb_runs);
+        static std::unique_ptr<TimeTracker> create();
 
         /**
          * Constructor.
-         * @param nb_runs the number of runs whose time should be tracked.
          */
-        explicit TimeTracker(int nb_runs);
+        TimeTracker();
 
         /**
          * Record the starting time point.
@@ -37,17 +36,44 @@ namespace experiments::trackers {
         void toc();
 
         /**
-         * Display the difference between the starting and stopping time points.
+         * Record an execution time measured elsewhere, e.g., by the runner that timed the episode.
+         * @param ns the execution time in nanoseconds
+         */
+        void record(uint64_t ns);
+
+        /**
+         * Display the statistics of the times elapsed between the starting and stopping time points.
          * @param output the output stream in which the display must be done.
          */
         void print(std::ostream &output) const;
 
+        /**
+         * Add the execution times recorded by another time tracker to the times recorded by this tracker.
+         * @param other the time tracker whose execution times should be added.
+         */
+        void merge(const TimeTracker &other);
+
+        /**
+         * Write the execution times recorded so far, e.g., to checkpoint an experiment.
+         * @param output the stream in which the execution times should be written
+         */
+        void save(std::ostream &output) const;
+
+        /**
+         * Add the execution times written by save() to the times recorded by this tracker.
+         * @param input the stream from which the execution times should be read
+         */
+        void load(std::istream &input);
+
+        /**
+         * Getter.
+         * @return the histogram of the execution times.
+         */
+        [[nodiscard]] const LatencyHistogram &histogram() const;
+
     private:
         std::chrono::time_point<std::chrono::steady_clock> begin;
-        std::chrono::time_point<std::chrono::steady_clock> end;
-        torch::Tensor ex_times_s{};
-        torch::Tensor ex_times_ms{};
-        int index;
+        LatencyHistogram ex_times;
     };
 
 }
@@ -0,0 +1,148 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <iomanip>
+#include <iostream>
+#include <unistd.h>
+#include "TraceRecorder.h"
+
+namespace experiments::trackers {
+
+    void TraceBuffer::push(const TraceEvent &event) {
+        uint64_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= CAPACITY) {
+            nb_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        events[h % CAPACITY] = event;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    TraceRecorder &TraceRecorder::instance() {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+
+    void TraceRecorder::start(const std::string &file_name) {
+        if (recording)
+            throw std::runtime_error("In TraceRecorder::start, a trace is already being recorded.");
+        file.open(file_name);
+        if (!file.is_open())
+            throw std::runtime_error("In TraceRecorder::start, could not open " + file_name + ".");
+        file << std::fixed << std::setprecision(3);
+        file << R"({"displayTimeUnit":"ms","traceEvents":[)";
+        first_event = true;
+        origin = std::chrono::steady_clock::now();
+        recording = true;
+        flusher = std::thread(&TraceRecorder::flushLoop, this);
+    }
+
+    void TraceRecorder::stop() {
+        if (!recording)
+            return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            recording = false;
+        }
+        wakeup.notify_all();
+        flusher.join();
+
+        // Write the remaining events, and name the threads of the trace.
+        std::lock_guard<std::mutex> lock(mutex);
+        flush();
+        uint64_t nb_dropped = 0;
+        for (auto &buffer : buffers) {
+            file << (first_event ? "" : ",") << '\n';
+            file << R"({"name":"thread_name","ph":"M","pid":)" << getpid() << R"(,"tid":)" << buffer->tid
+                 << R"(,"args":{"name":"worker )" << buffer->tid << R"("}})";
+            first_event = false;
+            nb_dropped += buffer->nb_dropped.exchange(0);
+        }
+        file << std::endl << "]}" << std::endl;
+        file.close();
+        if (nb_dropped != 0)
+            std::cerr << "In TraceRecorder::stop, " << nb_dropped << " events were dropped." << std::endl;
+    }
+
+    bool TraceRecorder::enabled() const {
+        return recording.load(std::memory_order_relaxed);
+    }
+
+    uint64_t TraceRecorder::now() const {
+        auto elapsed = std::chrono::steady_clock::now() - origin;
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+
+    void TraceRecorder::record(const TraceEvent &event) {
+        if (!enabled())
+            return;
+
+        // Wake up the flusher early when the buffer of the calling thread is filling up.
+        TraceBuffer &events = buffer();
+        events.push(event);
+        uint64_t size = events.head.load(std::memory_order_relaxed) - events.tail.load(std::memory_order_relaxed);
+        if (size == TraceBuffer::CAPACITY / 2)
+            wakeup.notify_one();
+    }
+
+    TraceRecorder::~TraceRecorder() {
+        stop();
+    }
+
+    TraceBuffer &TraceRecorder::buffer() {
+        static thread_local TraceBuffer *buffer = nullptr;
+        if (buffer == nullptr) {
+            std::lock_guard<std::mutex> lock(mutex);
+            buffers.push_back(std::make_unique<TraceBuffer>());
+            buffers.back()->tid = buffers.size();
+            buffer = buffers.back().get();
+        }
+        return *buffer;
+    }
+
+    void TraceRecorder::flushLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (recording) {
+            wakeup.wait_for(lock, std::chrono::milliseconds(10));
+            flush();
+        }
+    }
+
+    void TraceRecorder::flush() {
+        int pid = getpid();
+        for (auto &buffer : buffers) {
+            uint64_t t = buffer->tail.load(std::memory_order_relaxed);
+            uint64_t h = buffer->head.load(std::memory_order_acquire);
+            for (; t < h; ++t) {
+                const TraceEvent &event = buffer->events[t % TraceBuffer::CAPACITY];
+                file << (first_event ? "" : ",") << '\n';
+                file << R"({"name":")" << event.name << R"(","ph":"X","pid":)" << pid
+                     << R"(,"tid":)" << buffer->tid
+                     << R"(,"ts":)" << (double) event.begin_ns / 1000.0
+                     << R"(,"dur":)" << (double) event.duration_ns / 1000.0;
+                if (event.arg_name != nullptr)
+                    file << R"(,"args":{")" << event.arg_name << R"(":)" << event.arg_value << "}";
+                file << "}";
+                first_event = false;
+            }
+            buffer->tail.store(h, std::memory_order_release);
+        }
+    }
+
+    ScopedTrace::ScopedTrace(const char *name, const char *arg_name, int64_t arg_value) {
+        auto &recorder = TraceRecorder::instance();
+        enabled = recorder.enabled();
+        if (enabled)
+            event = {name, arg_name, arg_value, recorder.now(), 0};
+    }
+
+    ScopedTrace::~ScopedTrace() {
+        if (!enabled)
+            return;
+        auto &recorder = TraceRecorder::instance();
+        event.duration_ns = recorder.now() - event.begin_ns;
+        recorder.record(event);
+    }
+
+}
@@ -0,0 +1,155 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#ifndef EXPERIMENTS_AI_TS_TRACE_RECORDER_H
+#define EXPERIMENTS_AI_TS_TRACE_RECORDER_H
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <condition_variable>
+
+/**
+ * The macro EXPERIMENTS_TRACE(name) records the enclosing scope as a complete event of the trace, and the macro
+ * EXPERIMENTS_TRACE_ARG(name, arg_name, arg_value) additionally attaches an integer argument to the event. When no
+ * trace is being recorded, the cost of an event is a single atomic load.
+ */
+#define EXPERIMENTS_TRACE_CONCAT_IMPL(x, y) x##y
+#define EXPERIMENTS_TRACE_CONCAT(x, y) EXPERIMENTS_TRACE_CONCAT_IMPL(x, y)
+#define EXPERIMENTS_TRACE(name) \
+    experiments::trackers::ScopedTrace EXPERIMENTS_TRACE_CONCAT(experiments_trace_, __LINE__)(name)
+#define EXPERIMENTS_TRACE_ARG(name, arg_name, arg_value) \
+    experiments::trackers::ScopedTrace EXPERIMENTS_TRACE_CONCAT(experiments_trace_, __LINE__)(name, arg_name, arg_value)
+
+namespace experiments::trackers {
+
+    // Define an event of the trace, i.e., a named time interval of a thread.
+    struct TraceEvent {
+        const char *name;
+        const char *arg_name;
+        int64_t arg_value;
+        uint64_t begin_ns;
+        uint64_t duration_ns;
+    };
+
+    // Define a single-producer single-consumer ring buffer of events, the producer is the thread being traced.
+    struct TraceBuffer {
+        static constexpr uint64_t CAPACITY = 1 << 14;
+
+        uint32_t tid;
+        std::array<TraceEvent, CAPACITY> events;
+        std::atomic<uint64_t> head{0};
+        std::atomic<uint64_t> tail{0};
+        std::atomic<uint64_t> nb_dropped{0};
+
+        /**
+         * Add an event to the buffer, the event is dropped if the buffer is full.
+         * @param event the event
+         */
+        void push(const TraceEvent &event);
+    };
+
+    class TraceRecorder {
+    public:
+        /**
+         * Getter.
+         * @return the trace recorder of the process.
+         */
+        static TraceRecorder &instance();
+
+        /**
+         * Start recording the events of all threads, and writing them asynchronously in a Chrome trace file.
+         * @param file_name the name of the trace file, which can be opened by chrome://tracing or Perfetto.
+         */
+        void start(const std::string &file_name);
+
+        /**
+         * Stop recording, write the remaining events and close the trace file.
+         */
+        void stop();
+
+        /**
+         * Getter.
+         * @return true if the events are currently recorded, false otherwise.
+         */
+        [[nodiscard]] bool enabled() const;
+
+        /**
+         * Getter.
+         * @return the number of nanoseconds elapsed since the beginning of the trace.
+         */
+        [[nodiscard]] uint64_t now() const;
+
+        /**
+         * Record an event of the calling thread.
+         * @param event the event
+         */
+        void record(const TraceEvent &event);
+
+        /**
+         * Destructor, stop the recording if needed.
+         */
+        ~TraceRecorder();
+
+    private:
+        /**
+         * Getter.
+         * @return the buffer of the calling thread.
+         */
+        TraceBuffer &buffer();
+
+        /**
+         * Write the events of the buffers in the trace file until the recording is stopped.
+         */
+        void flushLoop();
+
+        /**
+         * Write the events currently stored in the buffers in the trace file.
+         */
+        void flush();
+
+    private:
+        std::atomic<bool> recording{false};
+        std::chrono::time_point<std::chrono::steady_clock> origin;
+        std::mutex mutex;
+        std::condition_variable wakeup;
+        std::vector<std::unique_ptr<TraceBuffer>> buffers;
+        std::thread flusher;
+        std::ofstream file;
+        bool first_event = true;
+    };
+
+    class ScopedTrace {
+    public:
+        /**
+         * Start an event of the trace.
+         * @param name the name of the event, must outlive the trace recording (e.g., a string literal)
+         * @param arg_name the name of the argument attached to the event, or nullptr if there is no argument
+         * @param arg_value the value of the argument attached to the event
+         */
+        explicit ScopedTrace(const char *name, const char *arg_name = nullptr, int64_t arg_value = 0);
+
+        /**
+         * Stop the event, and record it if the trace is being recorded.
+         */
+        ~ScopedTrace();
+
+        ScopedTrace(const ScopedTrace &) = delete;
+        ScopedTrace &operator=(const ScopedTrace &) = delete;
+
+    private:
+        TraceEvent event;
+        bool enabled;
+    };
+
+}
+
+#endif //EXPERIMENTS_AI_TS_TRACE_RECORDER_H
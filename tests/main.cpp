@@ -0,0 +1,6 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#define CATCH_CONFIG_MAIN
+#include <catch.hpp>
@@ -0,0 +1,73 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <catch.hpp>
+#include <array>
+#include <vector>
+#include "random/RandomStream.h"
+
+using namespace experiments::random;
+
+TEST_CASE( "RandomStream::philox matches the known-answer vectors of Philox4x32-10" ) {
+    REQUIRE( RandomStream::philox({0, 0, 0, 0}, {0, 0}) ==
+        std::array<uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8} );
+    REQUIRE( RandomStream::philox({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) ==
+        std::array<uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd} );
+    REQUIRE( RandomStream::philox({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+        std::array<uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1} );
+}
+
+TEST_CASE( "RandomStream draws the same numbers for the same key" ) {
+    RandomStream stream(42, 7, (uint64_t) StreamId::ENVIRONMENT);
+    std::vector<uint32_t> numbers;
+    for (int i = 0; i < 10; ++i) {
+        numbers.push_back(stream.next());
+    }
+
+    RandomStream replay(42, 7, (uint64_t) StreamId::ENVIRONMENT);
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE( replay.next() == numbers[i] );
+    }
+    RandomStream resumed(RandomState{42, 7, (uint64_t) StreamId::ENVIRONMENT, 5});
+    for (int i = 5; i < 10; ++i) {
+        REQUIRE( resumed.next() == numbers[i] );
+    }
+}
+
+TEST_CASE( "RandomStream draws different numbers for different episodes and streams" ) {
+    RandomStream stream(42, 7, 0);
+    RandomStream other_episode(42, 8, 0);
+    RandomStream other_stream(42, 7, 1);
+    int nb_equal_episodes = 0;
+    int nb_equal_streams = 0;
+    for (int i = 0; i < 100; ++i) {
+        uint32_t number = stream.next();
+        nb_equal_episodes += (number == other_episode.next());
+        nb_equal_streams += (number == other_stream.next());
+    }
+    REQUIRE( nb_equal_episodes == 0 );
+    REQUIRE( nb_equal_streams == 0 );
+}
+
+TEST_CASE( "RandomStream draws uniform numbers in [0, 1)" ) {
+    RandomStream stream(0, 0, 0);
+    double total = 0;
+    for (int i = 0; i < 10000; ++i) {
+        double number = stream.uniform();
+        REQUIRE( number >= 0 );
+        REQUIRE( number < 1 );
+        total += number;
+    }
+    REQUIRE( total / 10000 == Approx(0.5).margin(0.02) );
+}
+
+TEST_CASE( "RandomStream::uniform takes its high bits from the first draw" ) {
+    RandomStream stream(42, 7, 0);
+    RandomStream replay(42, 7, 0);
+    for (int i = 0; i < 100; ++i) {
+        uint64_t high_bits = replay.next();
+        uint64_t low_bits = replay.next();
+        REQUIRE( stream.uniform() == (double) ((high_bits << 21) ^ (low_bits >> 11)) * 0x1.0p-53 );
+    }
+}
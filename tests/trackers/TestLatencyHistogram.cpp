@@ -0,0 +1,99 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <catch.hpp>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "trackers/LatencyHistogram.h"
+
+using namespace experiments::trackers;
+
+TEST_CASE( "LatencyHistogram stores the small values exactly" ) {
+    for (uint64_t ns = 0; ns < LatencyHistogram::SUB_BUCKETS; ++ns) {
+        int index = LatencyHistogram::bucketIndex(ns);
+        REQUIRE( index == (int) ns );
+        REQUIRE( LatencyHistogram::bucketLowest(index) == ns );
+        REQUIRE( LatencyHistogram::bucketHighest(index) == ns );
+    }
+}
+
+TEST_CASE( "LatencyHistogram maps the largest value to the last bucket" ) {
+    uint64_t largest = std::numeric_limits<uint64_t>::max();
+    REQUIRE( LatencyHistogram::NB_BUCKETS == 3776 );
+    REQUIRE( LatencyHistogram::bucketIndex(largest) == 3775 );
+    REQUIRE( LatencyHistogram::bucketHighest(3775) == largest );
+
+    auto histogram = LatencyHistogram::create();
+    histogram->record(0);
+    histogram->record(largest);
+    REQUIRE( histogram->count() == 2 );
+    REQUIRE( histogram->min() == 0 );
+    REQUIRE( histogram->max() == largest );
+    REQUIRE( histogram->percentile(50) == 0 );
+    REQUIRE( histogram->percentile(100) == largest );
+}
+
+TEST_CASE( "LatencyHistogram buckets are contiguous and contain their bounds" ) {
+    for (int index = 0; index < LatencyHistogram::NB_BUCKETS; ++index) {
+        uint64_t lowest = LatencyHistogram::bucketLowest(index);
+        uint64_t highest = LatencyHistogram::bucketHighest(index);
+        REQUIRE( lowest <= highest );
+        REQUIRE( LatencyHistogram::bucketIndex(lowest) == index );
+        REQUIRE( LatencyHistogram::bucketIndex(highest) == index );
+        if (index + 1 < LatencyHistogram::NB_BUCKETS)
+            REQUIRE( LatencyHistogram::bucketLowest(index + 1) == highest + 1 );
+    }
+}
+
+TEST_CASE( "LatencyHistogram percentiles are within the relative error of the buckets" ) {
+    // Record values spread over several orders of magnitude, as the durations of short and long episodes.
+    std::vector<uint64_t> values;
+    auto histogram = LatencyHistogram::create();
+    for (uint64_t i = 1; i <= 100000; ++i) {
+        uint64_t ns = i * i * 37 + 1000;
+        values.push_back(ns);
+        histogram->record(ns);
+    }
+    std::sort(values.begin(), values.end());
+
+    double max_error = 1.0 / LatencyHistogram::SUB_BUCKETS;
+    for (double percentile : {1.0, 10.0, 50.0, 90.0, 99.0, 99.9, 100.0}) {
+        auto rank = (std::size_t) std::ceil(percentile / 100.0 * (double) values.size());
+        double exact = (double) values[rank - 1];
+        double reported = (double) histogram->percentile(percentile);
+        REQUIRE( reported >= exact );
+        REQUIRE( (reported - exact) / exact <= max_error );
+    }
+    REQUIRE( histogram->min() == values.front() );
+    REQUIRE( histogram->max() == values.back() );
+}
+
+TEST_CASE( "LatencyHistogram records values from several threads" ) {
+    const int nb_threads = 8;
+    const uint64_t nb_values = 100000;
+    auto histogram = LatencyHistogram::create();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nb_threads; ++t) {
+        threads.emplace_back([&histogram, t, nb_values]() {
+            for (uint64_t i = 0; i < nb_values; ++i) {
+                histogram->record(i + (uint64_t) t);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    uint64_t expected_total = 0;
+    for (int t = 0; t < nb_threads; ++t) {
+        expected_total += nb_values * (nb_values - 1) / 2 + nb_values * (uint64_t) t;
+    }
+    REQUIRE( histogram->count() == nb_threads * nb_values );
+    REQUIRE( histogram->total() == expected_total );
+    REQUIRE( histogram->min() == 0 );
+    REQUIRE( histogram->max() == nb_values - 1 + nb_threads - 1 );
+}
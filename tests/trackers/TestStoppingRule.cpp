@@ -0,0 +1,111 @@
+//
+// Created by Theophile Champion on 17/10/2026.
+//
+
+#include <catch.hpp>
+#include <cmath>
+#include "trackers/StoppingRule.h"
+
+using namespace experiments::trackers;
+
+namespace {
+    /**
+     * Create the outcome counts of episodes that either succeed or fail.
+     * @param successes the number of successes
+     * @param failures the number of failures
+     * @return the outcome counts, the success being the first outcome.
+     */
+    PerformanceSnapshot outcomes(double successes, double failures) {
+        return PerformanceSnapshot{{"success", "failure"}, {successes, failures}};
+    }
+}
+
+TEST_CASE( "StoppingRule::normalQuantile matches the quantiles of the standard normal distribution" ) {
+    REQUIRE( StoppingRule::normalQuantile(0.95) == Approx(1.959964).epsilon(1e-6) );
+    REQUIRE( StoppingRule::normalQuantile(0.99) == Approx(2.575829).epsilon(1e-6) );
+    REQUIRE( StoppingRule::normalQuantile(0.9) == Approx(1.644854).epsilon(1e-6) );
+    REQUIRE( StoppingRule::normalQuantile(0.5) == Approx(0.674490).epsilon(1e-6) );
+}
+
+TEST_CASE( "StoppingRule::wilson matches the Wilson score interval" ) {
+    auto [lower, upper] = StoppingRule::wilson(8, 10, 1.96);
+    REQUIRE( lower == Approx(0.4902).margin(1e-4) );
+    REQUIRE( upper == Approx(0.9433).margin(1e-4) );
+
+    // The interval stays in [0, 1] when all the trials succeed or fail, and is [0, 1] without trials.
+    auto [none_lower, none_upper] = StoppingRule::wilson(0, 10, 1.96);
+    REQUIRE( none_lower == 0 );
+    REQUIRE( none_upper == Approx(0.2775).margin(1e-4) );
+    auto [all_lower, all_upper] = StoppingRule::wilson(10, 10, 1.96);
+    REQUIRE( all_lower == Approx(0.7225).margin(1e-4) );
+    REQUIRE( all_upper == 1 );
+    auto [empty_lower, empty_upper] = StoppingRule::wilson(0, 0, 1.96);
+    REQUIRE( empty_lower == 0 );
+    REQUIRE( empty_upper == 1 );
+}
+
+TEST_CASE( "StoppingRule::logLikelihoodRatio adds the log-ratio of each trial" ) {
+    double ratio = StoppingRule::logLikelihoodRatio(3, 5, 0.4, 0.6);
+    REQUIRE( ratio == Approx(3 * std::log(1.5) + 2 * std::log(0.4 / 0.6)) );
+    REQUIRE( StoppingRule::logLikelihoodRatio(5, 10, 0.4, 0.6) == Approx(0).margin(1e-12) );
+}
+
+TEST_CASE( "StoppingRule stops at the boundaries of the sequential probability ratio test" ) {
+    // With p0 = 0.4 and p1 = 0.6, each success adds log(1.5) and each failure subtracts it, and the boundaries are
+    // log(19) and -log(19), i.e., eight more successes than failures are needed to decide.
+    StoppingOptions options;
+    options.min_episodes = 1;
+    options.baseline = 0.5;
+    options.effect = 0.1;
+    options.alpha = 0.05;
+    options.beta = 0.05;
+    auto rule = StoppingRule::create(options);
+    REQUIRE( rule->decide(outcomes(7, 0), 0) == StoppingDecision::CONTINUE );
+    REQUIRE( rule->decide(outcomes(8, 0), 0) == StoppingDecision::BETTER );
+    REQUIRE( rule->decide(outcomes(0, 7), 0) == StoppingDecision::CONTINUE );
+    REQUIRE( rule->decide(outcomes(0, 8), 0) == StoppingDecision::WORSE );
+    REQUIRE( rule->decide(outcomes(27, 20), 0) == StoppingDecision::CONTINUE );
+    REQUIRE( rule->decide(outcomes(28, 20), 0) == StoppingDecision::BETTER );
+
+    // The boundaries are log((1 - beta) / alpha) and log(beta / (1 - alpha)).
+    double upper = std::log((1 - options.beta) / options.alpha);
+    double lower = std::log(options.beta / (1 - options.alpha));
+    REQUIRE( StoppingRule::logLikelihoodRatio(7, 7, 0.4, 0.6) < upper );
+    REQUIRE( StoppingRule::logLikelihoodRatio(8, 8, 0.4, 0.6) >= upper );
+    REQUIRE( StoppingRule::logLikelihoodRatio(0, 8, 0.4, 0.6) <= lower );
+}
+
+TEST_CASE( "StoppingRule waits for the minimum number of episodes" ) {
+    StoppingOptions options;
+    options.min_episodes = 20;
+    options.baseline = 0.5;
+    auto rule = StoppingRule::create(options);
+    REQUIRE( rule->decide(outcomes(19, 0), 0) == StoppingDecision::CONTINUE );
+    REQUIRE( rule->decide(outcomes(20, 0), 0) == StoppingDecision::BETTER );
+    REQUIRE( rule->decide(outcomes(0, 0), 0) == StoppingDecision::CONTINUE );
+}
+
+TEST_CASE( "StoppingRule stops once every interval is narrower than the target width" ) {
+    StoppingOptions options;
+    options.min_episodes = 1;
+    options.target_width = 0.1;
+    auto rule = StoppingRule::create(options);
+    REQUIRE( rule->decide(outcomes(50, 50), 0) == StoppingDecision::CONTINUE );
+    REQUIRE( rule->decide(outcomes(200, 200), 0) == StoppingDecision::PRECISE );
+}
+
+TEST_CASE( "StoppingRule rejects invalid options" ) {
+    StoppingOptions options;
+    options.confidence = 1;
+    REQUIRE_THROWS( StoppingRule::create(options) );
+    options.confidence = 0.95;
+    options.baseline = 0.5;
+    options.effect = 0;
+    REQUIRE_THROWS( StoppingRule::create(options) );
+    options.effect = 0.1;
+    options.baseline = 1;
+    REQUIRE_THROWS( StoppingRule::create(options) );
+    options.baseline = -1;
+    options.effect = 0;
+    REQUIRE_NOTHROW( StoppingRule::create(options) );
+}